@@ -25,8 +25,17 @@ LIB_ALGORITHMS_H = $(wildcard $(DIR_LIBS)/$(DIR_ALGORITHMS_LIB)/*.h)
 LINKED_LIST_H = $(wildcard $(DIR_LIBS)/$(DIR_LINKED_LIST)/*.h)
 LIB_STACK_H = $(wildcard $(DIR_LIBS)/$(DIR_STACK_LIB)/*.h)
 LIB_QUEUE_H = $(wildcard $(DIR_LIBS)/$(DIR_QUEUE_LIB)/*.h)
-
-ALL_HEADERS = $(LIB_GRAPH_H) $(LIB_ALGORITHMS_H) $(LINKED_LIST_H) $(LIB_STACK_H) $(LIB_QUEUE_H)
+THREAD_POOL_H = $(wildcard $(DIR_LIBS)/$(DIR_THREAD_POOL)/*.h)
+RADIX_HEAP_H = $(wildcard $(DIR_LIBS)/$(DIR_RADIX_HEAP)/*.h)
+BUCKET_QUEUE_H = $(wildcard $(DIR_LIBS)/$(DIR_BUCKET_QUEUE)/*.h)
+LRU_CACHE_H = $(wildcard $(DIR_LIBS)/$(DIR_LRU_CACHE)/*.h)
+DISJOINT_SET_H = $(wildcard $(DIR_LIBS)/$(DIR_DISJOINT_SET)/*.h)
+RADIX_SORT_H = $(wildcard $(DIR_LIBS)/$(DIR_RADIX_SORT)/*.h)
+RANDOM_H = $(wildcard $(DIR_LIBS)/$(DIR_RANDOM)/*.h)
+
+ALL_HEADERS = $(LIB_GRAPH_H) $(LIB_ALGORITHMS_H) $(LINKED_LIST_H) $(LIB_STACK_H) $(LIB_QUEUE_H) $(THREAD_POOL_H) \
+	$(RADIX_HEAP_H) $(BUCKET_QUEUE_H) $(LRU_CACHE_H) $(DISJOINT_SET_H) $(RADIX_SORT_H) \
+	$(RANDOM_H)
 
 UML_INPUT_FILES = $(foreach file,$(ALL_HEADERS),-i $(file))
 
@@ -56,6 +65,13 @@ DIR_ALGORITHMS_LIB := s21_graph_algorithms
 DIR_LINKED_LIST := s21_linked_list
 DIR_STACK_LIB := s21_stack
 DIR_QUEUE_LIB := s21_queue
+DIR_THREAD_POOL := s21_thread_pool
+DIR_RADIX_HEAP := s21_radix_heap
+DIR_BUCKET_QUEUE := s21_bucket_queue
+DIR_LRU_CACHE := s21_lru_cache
+DIR_DISJOINT_SET := s21_disjoint_set
+DIR_RADIX_SORT := s21_radix_sort
+DIR_RANDOM := s21_random
 
 DIR_GRAPH_TEST := tests_s21_graph
 DIR_ALGORITHMS_TEST := tests_s21_graph_algorithms
@@ -0,0 +1,43 @@
+#ifndef S21_BUCKET_QUEUE_H
+#define S21_BUCKET_QUEUE_H
+
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Dial's circular bucket queue for unsigned integer keys. Keys held at once
+// must fit in [min key, min key + max spread] - true for Dijkstra's algorithm
+// with weights up to the spread and for Prim's keys. A key smaller than the
+// cursor moves it back, so keys don't have to be monotone.
+template <typename T, typename Key = unsigned>
+class bucket_queue {
+ public:
+  using value_type = T;
+  using key_type = Key;
+  using entry_type = std::pair<key_type, value_type>;
+  using size_type = size_t;
+
+  explicit bucket_queue(key_type a_max_spread);  // ring of spread+1 buckets
+
+  bool empty() const;
+  size_type size() const;
+
+  void push(key_type a_key, const value_type &a_value);
+  entry_type top();  // entry with the smallest key
+  void pop();        // removes top entry
+  void clear();      // removes all entries
+
+ private:
+  void advance();  // moves cursor to the first non-empty bucket
+
+  std::vector<std::vector<value_type>> buckets_;
+  key_type cursor_;  // no entry has a smaller key
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_bucket_queue.tpp"
+
+#endif
@@ -0,0 +1,53 @@
+#include "s21_bucket_queue.h"
+
+namespace s21 {
+
+template <typename T, typename Key>
+bucket_queue<T, Key>::bucket_queue(key_type a_max_spread)
+    : buckets_(static_cast<size_type>(a_max_spread) + 1),
+      cursor_(0),
+      size_(0) {}
+
+template <typename T, typename Key>
+bool bucket_queue<T, Key>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Key>
+typename bucket_queue<T, Key>::size_type bucket_queue<T, Key>::size() const {
+  return size_;
+}
+
+template <typename T, typename Key>
+void bucket_queue<T, Key>::push(key_type a_key, const value_type &a_value) {
+  if (size_ == 0 || a_key < cursor_) cursor_ = a_key;
+  buckets_[a_key % buckets_.size()].push_back(a_value);
+  ++size_;
+}
+
+template <typename T, typename Key>
+void bucket_queue<T, Key>::advance() {
+  while (buckets_[cursor_ % buckets_.size()].empty()) ++cursor_;
+}
+
+template <typename T, typename Key>
+typename bucket_queue<T, Key>::entry_type bucket_queue<T, Key>::top() {
+  advance();
+  return entry_type(cursor_, buckets_[cursor_ % buckets_.size()].back());
+}
+
+template <typename T, typename Key>
+void bucket_queue<T, Key>::pop() {
+  advance();
+  buckets_[cursor_ % buckets_.size()].pop_back();
+  --size_;
+}
+
+template <typename T, typename Key>
+void bucket_queue<T, Key>::clear() {
+  for (std::vector<value_type> &bucket : buckets_) bucket.clear();
+  cursor_ = 0;
+  size_ = 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,39 @@
+#ifndef S21_CONCURRENT_DISJOINT_SET_H
+#define S21_CONCURRENT_DISJOINT_SET_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// Lock-free union-find for threads which find and unite at the same time.
+// A root is linked under the smaller of the two roots with compare-and-swap
+// and retried if another thread linked it first; find halves paths with
+// the same instruction, so no thread ever waits for another.
+class concurrent_disjoint_set {
+ public:
+  using size_type = size_t;
+
+  explicit concurrent_disjoint_set(size_type a_size = 0);  // all alone
+  concurrent_disjoint_set(const concurrent_disjoint_set &) = delete;
+  concurrent_disjoint_set &operator=(const concurrent_disjoint_set &) =
+      delete;
+
+  size_type size() const;  // number of elements
+
+  size_type find(size_type a_element);  // representative of the set
+  // joins sets of both elements, false if they were already joined; of
+  // several threads uniting the same two sets exactly one gets true
+  bool unite(size_type a_first, size_type a_second);
+  bool same(size_type a_first, size_type a_second);
+
+ private:
+  std::vector<std::atomic<size_type>> parents_;
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_disjoint_set.tpp"
+
+#endif
@@ -0,0 +1,59 @@
+#include "s21_concurrent_disjoint_set.h"
+
+#include <utility>
+
+namespace s21 {
+
+inline concurrent_disjoint_set::concurrent_disjoint_set(size_type a_size)
+    : parents_(a_size) {
+  for (size_type element = 0; element < a_size; ++element)
+    parents_[element].store(element, std::memory_order_relaxed);
+}
+
+inline typename concurrent_disjoint_set::size_type
+concurrent_disjoint_set::size() const {
+  return parents_.size();
+}
+
+inline typename concurrent_disjoint_set::size_type
+concurrent_disjoint_set::find(size_type a_element) {
+  while (true) {
+    size_type parent = parents_[a_element].load(std::memory_order_acquire);
+    if (parent == a_element) return a_element;
+    const size_type grandparent =
+        parents_[parent].load(std::memory_order_acquire);
+    // Skipping a level keeps the set, so a lost race changes nothing
+    if (parent != grandparent)
+      parents_[a_element].compare_exchange_weak(parent, grandparent,
+                                                std::memory_order_release);
+    a_element = grandparent;
+  }
+}
+
+inline bool concurrent_disjoint_set::unite(size_type a_first,
+                                           size_type a_second) {
+  while (true) {
+    a_first = find(a_first);
+    a_second = find(a_second);
+    if (a_first == a_second) return false;
+    if (a_first < a_second) std::swap(a_first, a_second);
+    size_type expected = a_first;
+    if (parents_[a_first].compare_exchange_strong(expected, a_second,
+                                                  std::memory_order_acq_rel))
+      return true;
+  }
+}
+
+inline bool concurrent_disjoint_set::same(size_type a_first,
+                                          size_type a_second) {
+  while (true) {
+    a_first = find(a_first);
+    a_second = find(a_second);
+    if (a_first == a_second) return true;
+    // A root which is still a root was not joined in the meantime
+    if (parents_[a_first].load(std::memory_order_acquire) == a_first)
+      return false;
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,38 @@
+#ifndef S21_DISJOINT_SET_H
+#define S21_DISJOINT_SET_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Union-find over elements 0..n-1 with union by size and path halving, so
+// every operation takes near constant amortized time.
+class disjoint_set {
+ public:
+  using size_type = size_t;
+
+  explicit disjoint_set(size_type a_size = 0);  // every element alone
+
+  size_type size() const;       // number of elements
+  size_type set_count() const;  // number of disjoint sets
+
+  size_type find(size_type a_element);  // representative of the set
+  // joins sets of both elements, false if they were already joined
+  bool unite(size_type a_first, size_type a_second);
+  bool same(size_type a_first, size_type a_second);
+  size_type set_size(size_type a_element);  // size of the element's set
+  void reset(size_type a_size);             // a_size elements, each alone
+
+ private:
+  std::vector<size_type> parents_;
+  std::vector<size_type> sizes_;  // valid for representatives only
+  size_type set_count_;
+};
+
+}  // namespace s21
+
+#include "s21_disjoint_set.tpp"
+
+#endif
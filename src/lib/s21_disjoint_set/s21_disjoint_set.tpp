@@ -0,0 +1,52 @@
+#include "s21_disjoint_set.h"
+
+namespace s21 {
+
+inline disjoint_set::disjoint_set(size_type a_size) { reset(a_size); }
+
+inline typename disjoint_set::size_type disjoint_set::size() const {
+  return parents_.size();
+}
+
+inline typename disjoint_set::size_type disjoint_set::set_count() const {
+  return set_count_;
+}
+
+inline typename disjoint_set::size_type disjoint_set::find(
+    size_type a_element) {
+  while (parents_[a_element] != a_element) {
+    parents_[a_element] = parents_[parents_[a_element]];
+    a_element = parents_[a_element];
+  }
+  return a_element;
+}
+
+inline bool disjoint_set::unite(size_type a_first, size_type a_second) {
+  a_first = find(a_first);
+  a_second = find(a_second);
+  if (a_first == a_second) return false;
+  if (sizes_[a_first] < sizes_[a_second]) std::swap(a_first, a_second);
+  parents_[a_second] = a_first;
+  sizes_[a_first] += sizes_[a_second];
+  --set_count_;
+  return true;
+}
+
+inline bool disjoint_set::same(size_type a_first, size_type a_second) {
+  return find(a_first) == find(a_second);
+}
+
+inline typename disjoint_set::size_type disjoint_set::set_size(
+    size_type a_element) {
+  return sizes_[find(a_element)];
+}
+
+inline void disjoint_set::reset(size_type a_size) {
+  parents_.resize(a_size);
+  for (size_type element = 0; element < a_size; ++element)
+    parents_[element] = element;
+  sizes_.assign(a_size, 1);
+  set_count_ = a_size;
+}
+
+}  // namespace s21
@@ -0,0 +1,101 @@
+/**
+ * @file s21_fingerprint.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief 128-bit content hash of integer buffers
+ */
+
+#include "s21_fingerprint.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Odd constants of xxHash64
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+
+inline uint64_t rotate_left(const uint64_t a_value, const int a_bits) {
+  return (a_value << a_bits) | (a_value >> (64 - a_bits));
+}
+
+// Mixes 64 bits of input into a lane
+inline uint64_t mix_round(const uint64_t a_lane, const uint64_t a_input) {
+  return rotate_left(a_lane + a_input * kPrime2, 31) * kPrime1;
+}
+
+// Spreads every bit of a_value over the whole result
+inline uint64_t avalanche(uint64_t a_value) {
+  a_value ^= a_value >> 33;
+  a_value *= kPrime2;
+  a_value ^= a_value >> 29;
+  a_value *= kPrime3;
+  a_value ^= a_value >> 32;
+  return a_value;
+}
+
+// Two ints as one 64-bit input
+inline uint64_t pack(const int a_first, const int a_second) {
+  return static_cast<uint32_t>(a_first) |
+         static_cast<uint64_t>(static_cast<uint32_t>(a_second)) << 32;
+}
+
+}  // namespace
+
+std::string Fingerprint::ToHex() const {
+  static const char digits[] = "0123456789abcdef";
+  std::string result(32, '0');
+  for (int i = 0; i < 16; ++i) {
+    result[15 - i] = digits[(high >> (4 * i)) & 0xF];
+    result[31 - i] = digits[(low >> (4 * i)) & 0xF];
+  }
+  return result;
+}
+
+FingerprintHasher::FingerprintHasher()
+    : lanes_{kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1} {}
+
+void FingerprintHasher::consume(const int* a_cells) {
+  for (size_t lane = 0; lane < 4; ++lane)
+    lanes_[lane] = mix_round(
+        lanes_[lane], pack(a_cells[2 * lane], a_cells[2 * lane + 1]));
+}
+
+void FingerprintHasher::Update(const int* a_cells, const size_t a_count) {
+  total_count_ += a_count;
+  size_t index = 0;
+  if (pending_count_ > 0) {
+    const size_t taken = std::min(kStripe - pending_count_, a_count);
+    std::memcpy(pending_ + pending_count_, a_cells, taken * sizeof(int));
+    pending_count_ += taken;
+    index = taken;
+    if (pending_count_ < kStripe) return;
+    consume(pending_);
+    pending_count_ = 0;
+  }
+  for (; index + kStripe <= a_count; index += kStripe)
+    consume(a_cells + index);
+  pending_count_ = a_count - index;
+  std::memcpy(pending_, a_cells + index, pending_count_ * sizeof(int));
+}
+
+Fingerprint FingerprintHasher::Finish() const {
+  uint64_t lanes[4] = {lanes_[0], lanes_[1], lanes_[2], lanes_[3]};
+  for (size_t i = 0; i < pending_count_; ++i)
+    lanes[i % 4] = mix_round(lanes[i % 4], static_cast<uint32_t>(pending_[i]));
+  const uint64_t length = total_count_ * kPrime4;
+  // Both halves read all four lanes, combined in different ways
+  Fingerprint result;
+  result.low = avalanche(rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) +
+                         rotate_left(lanes[2], 12) +
+                         rotate_left(lanes[3], 18) + length);
+  result.high =
+      avalanche((lanes[0] ^ rotate_left(lanes[1], 13) ^
+                 rotate_left(lanes[2], 29) ^ rotate_left(lanes[3], 43)) *
+                    kPrime3 +
+                length + kPrime1);
+  return result;
+}
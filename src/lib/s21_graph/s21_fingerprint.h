@@ -0,0 +1,82 @@
+/**
+ * @file s21_fingerprint.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief 128-bit content hash of integer buffers
+ */
+
+#ifndef S21_FINGERPRINT_H
+#define S21_FINGERPRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief 128-bit hash value
+ */
+struct Fingerprint {
+  uint64_t low = 0;   ///< Lower half
+  uint64_t high = 0;  ///< Upper half
+
+  /**
+   * @brief Compares two hashes
+   * @return true if both halves are equal
+   */
+  bool operator==(const Fingerprint&) const = default;
+
+  /**
+   * @brief Formats hash as text
+   * @return 32 lowercase hex digits, upper half first
+   */
+  std::string ToHex() const;
+};
+
+/**
+ * @class FingerprintHasher
+ * @brief Streaming 128-bit hash of a sequence of ints
+ *
+ * Four independent 64-bit lanes take two ints each from every 32-byte
+ * stripe (multiply-rotate rounds like xxHash64), so the compiler keeps them
+ * in registers or vector lanes and the loop runs at memory speed. The
+ * result depends only on the sequence, not on how it is split between
+ * Update calls. Not a cryptographic hash.
+ */
+class FingerprintHasher {
+ public:
+  FingerprintHasher();             ///< Hasher of an empty sequence
+  ~FingerprintHasher() = default;  ///< Default destructor
+
+  /**
+   * @brief Appends ints to the sequence
+   * @param[in] a_cells First int
+   * @param[in] a_count Number of ints
+   */
+  void Update(const int* a_cells, const size_t a_count);
+
+  /**
+   * @brief Computes hash of the sequence appended so far
+   * @return Hash value, the hasher stays usable
+   */
+  Fingerprint Finish() const;
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  static constexpr size_t kStripe = 8;  ///< Ints of one round of all lanes
+
+  uint64_t lanes_[4];         ///< Lane accumulators
+  int pending_[kStripe];      ///< Ints of the incomplete stripe
+  size_t pending_count_ = 0;  ///< Number of pending ints
+  uint64_t total_count_ = 0;  ///< Number of appended ints
+
+  /**
+   * @brief Mixes one full stripe into the lanes
+   * @param[in] a_cells kStripe ints
+   */
+  void consume(const int* a_cells);
+};
+
+#endif
@@ -23,6 +23,28 @@ Graph Graph::LoadGraphFromFile(const std::string& a_filename) {
   return result;
 }
 
+int Graph::set_edge_weight(size_t a_from, size_t a_to, int a_weight) {
+  if (a_from >= graph_size_ || a_to >= graph_size_) {
+    throw std::invalid_argument("Invalid vertex value");
+  }
+  if (a_weight < 0) {
+    throw std::invalid_argument("Negative edge weight");
+  }
+  const int old_weight = adjacency_matrix_[a_from][a_to];
+  adjacency_matrix_[a_from][a_to] = a_weight;
+  revision_ = next_revision();
+  return old_weight;
+}
+
+Fingerprint Graph::get_fingerprint() const {
+  FingerprintHasher hasher;
+  const int size = static_cast<int>(graph_size_);
+  hasher.Update(&size, 1);
+  for (const Alias::IntRow& row : adjacency_matrix_)
+    hasher.Update(row.data(), row.size());
+  return hasher.Finish();
+}
+
 void Graph::ExportGraphToDot(const std::string& a_filename) {
   std::ofstream file(a_filename);
   if (!file) {
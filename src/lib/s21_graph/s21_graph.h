@@ -7,12 +7,14 @@
 #ifndef S21_GRAPH_H
 #define S21_GRAPH_H
 
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include "common.h"
 #include "filereader.h"
+#include "s21_fingerprint.h"
 
 class FileReader;
 
@@ -69,12 +71,53 @@ class Graph {
    */
   bool is_valid_graph() const { return valid_graph_; }
 
+  /**
+   * @brief Gets the revision of the graph contents.
+   * @details Every constructed or loaded graph gets a new revision, so does
+   * every modifying access. Any access through the non-const operator[]
+   * counts as modifying, reads included - read a non-const graph through a
+   * const reference (e.g. std::as_const) to keep its revision. Copies share
+   * the revision of their source while both are unchanged. Results computed
+   * for a revision stay valid until it changes.
+   * @return The revision number.
+   */
+  unsigned long long get_revision() const { return revision_; }
+
+  /**
+   * @brief Computes a 128-bit hash of the graph contents.
+   * @details Covers the size and every cell of the adjacency matrix, so
+   * equal matrices loaded in different processes give equal fingerprints.
+   * Takes one pass over the matrix.
+   * @return The fingerprint.
+   */
+  Fingerprint get_fingerprint() const;
+
+  /**
+   * @brief Sets the weight of an edge.
+   * @details Moves the graph to a new revision. Only the given direction is
+   * changed, an undirected edge needs a call for each direction.
+   * @param[in] a_from The index of the source vertex.
+   * @param[in] a_to The index of the target vertex.
+   * @param[in] a_weight The new weight, 0 removes the edge.
+   * @return The previous weight, 0 if there was no edge.
+   * @throws std::invalid_argument if a vertex is out of range or the weight is
+   * negative.
+   */
+  int set_edge_weight(size_t a_from, size_t a_to, int a_weight);
+
   /**
    * @brief Accesses a row of the adjacency matrix for modification.
+   * @details Moves the graph to a new revision even if the row is only read,
+   * since the returned reference may be written later. Results cached for the
+   * old revision (ShortPathCache, DynamicShortPath, edge density) are rebuilt.
+   * Reads should go through the const overload.
    * @param row The index of the row to access.
    * @return A reference to the specified row in the adjacency matrix.
    */
-  Alias::IntRow& operator[](size_t row) { return adjacency_matrix_[row]; }
+  Alias::IntRow& operator[](size_t row) {
+    revision_ = next_revision();
+    return adjacency_matrix_[row];
+  }
 
   /**
    * @brief Accesses a row of the adjacency matrix (const version).
@@ -96,6 +139,17 @@ class Graph {
   Alias::IntGrid adjacency_matrix_;
   /// Flag indicating if the graph is valid.
   bool valid_graph_;
+  /// Revision of the contents, unique among all graphs of the process.
+  unsigned long long revision_ = next_revision();
+
+  /**
+   * @brief Takes a new revision number from the process wide counter.
+   * @return The revision number.
+   */
+  static unsigned long long next_revision() {
+    static std::atomic<unsigned long long> counter{0};
+    return ++counter;
+  }
 
   /**
    * @brief Exports configuration text to a file.
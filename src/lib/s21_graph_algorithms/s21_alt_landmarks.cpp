@@ -0,0 +1,298 @@
+/**
+ * @file s21_alt_landmarks.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief A* search with landmark lower bounds (ALT)
+ */
+
+#include "s21_alt_landmarks.h"
+
+namespace {
+
+/// First word of a landmark tables file
+const std::string alt_file_header = "ALT";
+
+bool is_symmetric_graph(const Graph& a_graph) {
+  const size_t size = a_graph.get_graph_size();
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = i + 1; j < size; ++j) {
+      if (a_graph[i][j] != a_graph[j][i]) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+AltLandmarks::AltLandmarks(const Graph& a_graph)
+    : forward_{CsrGraph::FromGraph(a_graph)},
+      size_{a_graph.get_graph_size()},
+      directed_{!is_symmetric_graph(a_graph)},
+      fingerprint_{a_graph.get_fingerprint()} {
+  distances_.assign(size_, UINT_MAX);
+  bounds_.assign(size_, 0);
+  prev_nodes_.assign(size_, -1);
+  stamps_.assign(size_, 0);
+}
+
+AltLandmarks::AltLandmarks(const Graph& a_graph, const size_t a_count,
+                           const LandmarkSelection a_selection)
+    : AltLandmarks(a_graph) {
+  const size_t count = std::min(a_count, size_);
+  // d(v, L) is d(L, v) in the transposed graph
+  Graph transposed(directed_ ? size_ : 0);
+  for (size_t i = 0; i < transposed.get_graph_size(); ++i) {
+    for (size_t j = 0; j < size_; ++j) transposed[j][i] = a_graph[i][j];
+  }
+  // Fixed seed - the same graph always gets the same landmarks
+  std::mt19937 gen(static_cast<unsigned>(count));
+  std::uniform_int_distribution<Alias::node_index> random_vertex(
+      0, size_ > 0 ? size_ - 1 : 0);
+  while (landmarks_.size() < count) {
+    Alias::node_index next = size_;
+    if (a_selection == LandmarkSelection::kAvoid)
+      next = avoid_vertex(a_graph, random_vertex(gen));
+    if (next == size_ || std::find(landmarks_.begin(), landmarks_.end(),
+                                   next) != landmarks_.end())
+      next = farthest_vertex(a_graph);
+    add_landmark(a_graph, transposed, next);
+  }
+}
+
+void AltLandmarks::add_landmark(const Graph& a_graph, const Graph& a_transposed,
+                                const Alias::node_index a_landmark) {
+  landmarks_.push_back(a_landmark);
+  ShortPath from = GraphAlgorithms::GetShortPath(a_graph, a_landmark);
+  from_landmark_.insert(from_landmark_.end(), from.distances.begin(),
+                        from.distances.end());
+  if (directed_) {
+    ShortPath to = GraphAlgorithms::GetShortPath(a_transposed, a_landmark);
+    to_landmark_.insert(to_landmark_.end(), to.distances.begin(),
+                        to.distances.end());
+  }
+}
+
+Alias::node_index AltLandmarks::farthest_vertex(const Graph& a_graph) const {
+  // Without landmarks take the vertex farthest from vertex 0
+  std::vector<Alias::distance> closest(size_, UINT_MAX);
+  if (landmarks_.empty()) {
+    closest = GraphAlgorithms::GetShortPath(a_graph, 0).distances;
+    for (Alias::distance& value : closest) {
+      if (value == UINT_MAX) value = 0;
+    }
+  }
+  for (size_t i = 0; i < landmarks_.size(); ++i) {
+    for (size_t v = 0; v < size_; ++v) {
+      closest[v] = std::min(closest[v], table(from_landmark_, i, v));
+    }
+  }
+  Alias::node_index result = 0;
+  Alias::distance result_distance = 0;
+  for (size_t v = 0; v < size_; ++v) {
+    bool is_landmark = std::find(landmarks_.begin(), landmarks_.end(), v) !=
+                       landmarks_.end();
+    if (is_landmark) continue;
+    if (result_distance == 0 || closest[v] > result_distance) {
+      result = v;
+      result_distance = std::max<Alias::distance>(closest[v], 1);
+    }
+  }
+  return result;
+}
+
+Alias::node_index AltLandmarks::avoid_vertex(
+    const Graph& a_graph, const Alias::node_index a_root) const {
+  auto [distance_array, prev_node] = GraphAlgorithms::GetShortPath(a_graph,
+                                                                   a_root);
+  // Children are processed before parents - they are strictly farther
+  std::vector<Alias::node_index> order;
+  for (size_t v = 0; v < size_; ++v) {
+    if (distance_array[v] != UINT_MAX) order.push_back(v);
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a_left, size_t a_right) {
+    return distance_array[a_left] > distance_array[a_right];
+  });
+  // Weight - how badly the current landmarks bound d(root, v). Size - sum of
+  // weights in the subtree, zero if the subtree already holds a landmark
+  std::vector<unsigned long long> subtree_size(size_, 0);
+  std::vector<bool> has_landmark(size_, false);
+  for (Alias::node_index landmark : landmarks_) has_landmark[landmark] = true;
+  for (Alias::node_index v : order) {
+    if (!has_landmark[v])
+      subtree_size[v] += distance_array[v] - lower_bound(a_root, v);
+    int parent = prev_node[v];
+    if (parent == -1) continue;
+    if (has_landmark[v]) {
+      has_landmark[parent] = true;
+    } else {
+      subtree_size[parent] += subtree_size[v];
+    }
+  }
+  for (Alias::node_index v : order) {
+    if (has_landmark[v]) subtree_size[v] = 0;
+  }
+
+  Alias::node_index result = size_;
+  for (Alias::node_index v : order) {
+    if (subtree_size[v] > 0 &&
+        (result == size_ || subtree_size[v] > subtree_size[result]))
+      result = v;
+  }
+  if (result == size_) return result;
+  // Go down to a leaf through the heaviest children
+  std::vector<std::vector<Alias::node_index>> children(size_);
+  for (Alias::node_index v : order) {
+    if (prev_node[v] != -1) children[prev_node[v]].push_back(v);
+  }
+  while (true) {
+    Alias::node_index next = size_;
+    for (Alias::node_index child : children[result]) {
+      if (subtree_size[child] > 0 &&
+          (next == size_ || subtree_size[child] > subtree_size[next]))
+        next = child;
+    }
+    if (next == size_) break;
+    result = next;
+  }
+  return result;
+}
+
+Alias::distance AltLandmarks::lower_bound(const Alias::node_index a_from,
+                                          const Alias::node_index a_to) const {
+  const std::vector<Alias::distance>& to_table =
+      directed_ ? to_landmark_ : from_landmark_;
+  Alias::distance result = 0;
+  for (size_t i = 0; i < landmarks_.size(); ++i) {
+    // d(L, to) - d(L, from)
+    Alias::distance landmark_to = table(from_landmark_, i, a_to);
+    Alias::distance landmark_from = table(from_landmark_, i, a_from);
+    if (landmark_to != UINT_MAX && landmark_from != UINT_MAX &&
+        landmark_to > landmark_from)
+      result = std::max(result, landmark_to - landmark_from);
+    // d(from, L) - d(to, L)
+    Alias::distance from_landmark = table(to_table, i, a_from);
+    Alias::distance to_landmark = table(to_table, i, a_to);
+    if (from_landmark != UINT_MAX && to_landmark != UINT_MAX &&
+        from_landmark > to_landmark)
+      result = std::max(result, from_landmark - to_landmark);
+  }
+  return result;
+}
+
+RouteResult AltLandmarks::FindRoute(const int a_vertex1, const int a_vertex2) {
+  if ((a_vertex1 <= 0 || static_cast<size_t>(a_vertex1) > size_) ||
+      (a_vertex2 <= 0 || static_cast<size_t>(a_vertex2) > size_))
+    throw std::invalid_argument("Invalid vertex value");
+  const Alias::node_index start = a_vertex1 - 1;
+  const Alias::node_index end = a_vertex2 - 1;
+  settled_count_ = 0;
+  if (start == end) return {0, {a_vertex1}};
+
+  if (++query_stamp_ == 0) {
+    stamps_.assign(size_, 0);
+    query_stamp_ = 1;
+  }
+  // Reaches vertex in current query, bound is computed once per query
+  auto reach = [&](Alias::node_index a_vertex, Alias::distance a_distance,
+                   int a_prev) {
+    if (stamps_[a_vertex] != query_stamp_) {
+      stamps_[a_vertex] = query_stamp_;
+      bounds_[a_vertex] = lower_bound(a_vertex, end);
+    }
+    distances_[a_vertex] = a_distance;
+    prev_nodes_[a_vertex] = a_prev;
+  };
+  auto distance_of = [&](Alias::node_index a_vertex) {
+    return stamps_[a_vertex] == query_stamp_ ? distances_[a_vertex] : UINT_MAX;
+  };
+
+  // Min-heap by distance + lower bound to target
+  using QueueItem = std::pair<unsigned long long, Alias::node_index>;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>>
+      queue_nodes;
+  reach(start, 0, -1);
+  queue_nodes.push(std::make_pair(bounds_[start], start));
+
+  while (!queue_nodes.empty()) {
+    auto [current_key, current_node] = queue_nodes.top();
+    queue_nodes.pop();
+    const Alias::distance current_distance = distances_[current_node];
+    // Bounds of unreachable landmarks are skipped, so the potential may be
+    // inconsistent - vertices can be reopened, stale entries are dropped here
+    const unsigned long long current_bound = bounds_[current_node];
+    if (current_key != current_distance + current_bound) continue;
+    settled_count_++;
+    if (current_node == end) {
+      RouteResult result{current_distance, {}};
+      for (int at = end; at != -1; at = prev_nodes_[at])
+        result.vertices.push_back(at + 1);
+      std::reverse(result.vertices.begin(), result.vertices.end());
+      return result;
+    }
+    for (size_t edge = forward_.begin(current_node);
+         edge < forward_.end(current_node); ++edge) {
+      const Alias::node_index i_neighbor = forward_.target(edge);
+      const Alias::distance perspective_distance =
+          current_distance + forward_.weight(edge);
+      if (perspective_distance < distance_of(i_neighbor)) {
+        reach(i_neighbor, perspective_distance, static_cast<int>(current_node));
+        queue_nodes.push(std::make_pair(
+            static_cast<unsigned long long>(perspective_distance) +
+                bounds_[i_neighbor],
+            i_neighbor));
+      }
+    }
+  }
+  return {UINT_MAX, {}};
+}
+
+void AltLandmarks::SaveToFile(const std::string& a_filename) const {
+  std::ofstream file(a_filename);
+  if (!file) {
+    throw std::invalid_argument("Cannot write to file: " + a_filename);
+  }
+  file << alt_file_header << Serialize::tab_symb << size_ << Serialize::tab_symb
+       << landmarks_.size() << Serialize::tab_symb << directed_
+       << Serialize::tab_symb << fingerprint_.ToHex() << Serialize::new_line;
+  for (Alias::node_index landmark : landmarks_) {
+    file << landmark << Serialize::tab_symb;
+  }
+  file << Serialize::new_line;
+  for (const auto* landmark_table : {&from_landmark_, &to_landmark_}) {
+    for (size_t i = 0; i < landmark_table->size(); ++i) {
+      file << (*landmark_table)[i];
+      file << ((i + 1) % size_ ? Serialize::tab_symb : Serialize::new_line);
+    }
+  }
+  file.close();
+}
+
+AltLandmarks AltLandmarks::LoadFromFile(const Graph& a_graph,
+                                        const std::string& a_filename) {
+  AltLandmarks result(a_graph);
+  std::ifstream file(a_filename);
+  std::string header, fingerprint;
+  size_t size{0}, count{0};
+  bool directed{false};
+  if (!(file >> header >> size >> count >> directed >> fingerprint) ||
+      header != alt_file_header || size != result.size_ ||
+      directed != result.directed_ || count > size ||
+      fingerprint != result.fingerprint_.ToHex()) {
+    throw std::invalid_argument("Cannot load landmarks from file: " +
+                                a_filename);
+  }
+  result.landmarks_.resize(count);
+  result.from_landmark_.resize(count * size);
+  result.to_landmark_.resize(directed ? count * size : 0);
+  for (Alias::node_index& landmark : result.landmarks_) file >> landmark;
+  for (Alias::distance& value : result.from_landmark_) file >> value;
+  for (Alias::distance& value : result.to_landmark_) file >> value;
+  bool valid_landmarks = std::all_of(
+      result.landmarks_.begin(), result.landmarks_.end(),
+      [size](Alias::node_index landmark) { return landmark < size; });
+  if (!file || !valid_landmarks) {
+    throw std::invalid_argument("Cannot load landmarks from file: " +
+                                a_filename);
+  }
+  return result;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file s21_alt_landmarks.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief A* search with landmark lower bounds (ALT)
+ */
+
+#ifndef S21_ALT_LANDMARKS_H
+#define S21_ALT_LANDMARKS_H
+
+#include <fstream>
+#include <string>
+
+#include "s21_csr_graph.h"
+#include "s21_graph_algorithms.h"
+
+/**
+ * @enum LandmarkSelection
+ * @brief Strategy of picking landmarks during preprocessing
+ */
+enum class LandmarkSelection {
+  kFarthest,  ///< Every next landmark is the farthest one from chosen ones
+  kAvoid      ///< Goldberg-Werneck "avoid" - covers badly bounded regions
+};
+
+/**
+ * @class AltLandmarks
+ * @brief Landmark distance tables and A* queries over them
+ *
+ * Preprocessing runs GraphAlgorithms::GetShortPath from every landmark (and
+ * on the transposed graph for directed graphs). A query lower bounds the
+ * distance to target with the triangle inequality:
+ * d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L).
+ * Tables can be saved next to the graph file and loaded back.
+ */
+class AltLandmarks {
+ public:
+  /**
+   * @brief Selects landmarks and computes their distance tables
+   * @param[in] a_graph Input graph
+   * @param[in] a_count Number of landmarks (at most number of vertices)
+   * @param[in] a_selection Landmark selection strategy
+   */
+  AltLandmarks(const Graph& a_graph, const size_t a_count,
+               const LandmarkSelection a_selection = LandmarkSelection::kAvoid);
+
+  ~AltLandmarks() = default;  ///< Default destructor
+
+  /**
+   * @brief Loads landmark tables saved by SaveToFile
+   * @param[in] a_graph Graph the tables were built for
+   * @param[in] a_filename The name of the file to load tables from
+   * @return AltLandmarks ready for queries
+   * @details The file keeps the graph fingerprint, tables of another graph
+   * of the same size are rejected
+   * @throws std::invalid_argument if file is missing or does not match graph
+   */
+  static AltLandmarks LoadFromFile(const Graph& a_graph,
+                                   const std::string& a_filename);
+
+  /**
+   * @brief Saves landmark tables to a text file
+   * @param[in] a_filename The name of the file (e.g. graph file name + .alt)
+   */
+  void SaveToFile(const std::string& a_filename) const;
+
+  /**
+   * @brief Finds shortest route between two vertices with A*
+   * @param[in] a_vertex1 Source vertex (numeration from 1)
+   * @param[in] a_vertex2 Target vertex (numeration from 1)
+   * @return RouteResult like GraphAlgorithms::GetShortestRouteBetweenVertices
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  RouteResult FindRoute(const int a_vertex1, const int a_vertex2);
+
+  /**
+   * @brief Gets lower bound of distance between two vertices
+   * @param[in] a_from Vertex index
+   * @param[in] a_to Vertex index
+   * @return Largest landmark lower bound
+   */
+  Alias::distance lower_bound(const Alias::node_index a_from,
+                              const Alias::node_index a_to) const;
+
+  /**
+   * @brief Gets chosen landmarks
+   * @return Landmark indexes in order of selection
+   */
+  const std::vector<Alias::node_index>& get_landmarks() const {
+    return landmarks_;
+  }
+
+  /**
+   * @brief Gets number of vertices settled by the last query
+   * @return Settled vertices count
+   */
+  size_t get_settled_count() const { return settled_count_; }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  CsrGraph forward_;                        ///< Outgoing edges
+  size_t size_;                             ///< Number of vertices
+  bool directed_;                           ///< Separate to-landmark tables
+  Fingerprint fingerprint_;                 ///< Graph the tables are for
+  std::vector<Alias::node_index> landmarks_;  ///< Chosen landmarks
+  /// d(L, v) of landmark i at [i * size_ + v]
+  std::vector<Alias::distance> from_landmark_;
+  /// d(v, L) of landmark i at [i * size_ + v], empty for undirected graphs
+  std::vector<Alias::distance> to_landmark_;
+
+  // Query buffers, valid for entries stamped with query_stamp_
+  std::vector<Alias::distance> distances_;  ///< Tentative distances
+  std::vector<Alias::distance> bounds_;     ///< Cached lower bounds
+  std::vector<int> prev_nodes_;             ///< Previous nodes
+  std::vector<unsigned> stamps_;            ///< Query that wrote the vertex
+  unsigned query_stamp_ = 0;                ///< Current query number
+  size_t settled_count_ = 0;                ///< Settled in last query
+
+  /**
+   * @brief Prepares adjacency arrays and query buffers
+   * @param[in] a_graph Input graph
+   */
+  explicit AltLandmarks(const Graph& a_graph);
+
+  /**
+   * @brief Adds landmark and its distance tables
+   * @param[in] a_graph Input graph
+   * @param[in] a_transposed Transposed graph, used for directed graphs
+   * @param[in] a_landmark New landmark
+   */
+  void add_landmark(const Graph& a_graph, const Graph& a_transposed,
+                    const Alias::node_index a_landmark);
+
+  /**
+   * @brief Picks vertex farthest from chosen landmarks
+   * @param[in] a_graph Input graph, used while no landmark is chosen
+   * @return Vertex index
+   */
+  Alias::node_index farthest_vertex(const Graph& a_graph) const;
+
+  /**
+   * @brief Picks a landmark with the "avoid" heuristic
+   * @param[in] a_graph Input graph
+   * @param[in] a_root Root of the shortest path tree
+   * @return Vertex index or size_ if no vertex is worth it
+   */
+  Alias::node_index avoid_vertex(const Graph& a_graph,
+                                 const Alias::node_index a_root) const;
+
+  /**
+   * @brief Gets distance from landmark table
+   * @param[in] a_table from_landmark_ or to_landmark_
+   * @param[in] a_landmark Landmark number
+   * @param[in] a_vertex Vertex index
+   * @return Stored distance
+   */
+  Alias::distance table(const std::vector<Alias::distance>& a_table,
+                        const size_t a_landmark,
+                        const Alias::node_index a_vertex) const {
+    return a_table[a_landmark * size_ + a_vertex];
+  }
+};
+
+#endif
@@ -0,0 +1,131 @@
+/**
+ * @file s21_bidirectional_dijkstra.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Bidirectional Dijkstra's algorithm for point-to-point queries
+ */
+
+#include "s21_bidirectional_dijkstra.h"
+
+BidirectionalDijkstra::BidirectionalDijkstra(const Graph& a_graph)
+    : forward_{CsrGraph::FromGraph(a_graph)}, symmetric_{true} {
+  const size_t size = a_graph.get_graph_size();
+  for (size_t i = 0; i < size && symmetric_; ++i) {
+    for (size_t j = i + 1; j < size; ++j) {
+      if (a_graph[i][j] != a_graph[j][i]) {
+        symmetric_ = false;
+        break;
+      }
+    }
+  }
+  if (!symmetric_) backward_ = CsrGraph::Transposed(a_graph);
+  for (Side& side : sides_) {
+    side.distances.assign(size, UINT_MAX);
+    side.prev_nodes.assign(size, -1);
+    side.stamps.assign(size, 0);
+    side.settled.assign(size, false);
+  }
+}
+
+Alias::distance BidirectionalDijkstra::distance_of(
+    const Side& a_side, const Alias::node_index a_vertex) const {
+  return a_side.stamps[a_vertex] == query_stamp_ ? a_side.distances[a_vertex]
+                                                 : UINT_MAX;
+}
+
+void BidirectionalDijkstra::reach(Side& a_side,
+                                  const Alias::node_index a_vertex,
+                                  const Alias::distance a_distance,
+                                  const int a_prev) {
+  if (a_side.stamps[a_vertex] != query_stamp_) {
+    a_side.stamps[a_vertex] = query_stamp_;
+    a_side.settled[a_vertex] = false;
+  }
+  a_side.distances[a_vertex] = a_distance;
+  a_side.prev_nodes[a_vertex] = a_prev;
+  a_side.queue.push(std::make_pair(a_distance, a_vertex));
+}
+
+RouteResult BidirectionalDijkstra::FindRoute(const int a_vertex1,
+                                             const int a_vertex2) {
+  const size_t size = forward_.get_vertices_count();
+  if ((a_vertex1 <= 0 || static_cast<size_t>(a_vertex1) > size) ||
+      (a_vertex2 <= 0 || static_cast<size_t>(a_vertex2) > size))
+    throw std::invalid_argument("Invalid vertex value");
+  const Alias::node_index start = a_vertex1 - 1;
+  const Alias::node_index end = a_vertex2 - 1;
+  settled_count_ = 0;
+  if (start == end) return {0, {a_vertex1}};
+
+  // New stamp makes every buffer entry of the previous query stale
+  if (++query_stamp_ == 0) {
+    for (Side& side : sides_) side.stamps.assign(size, 0);
+    query_stamp_ = 1;
+  }
+  for (Side& side : sides_) side.queue = Queue();
+  reach(sides_[0], start, 0, -1);
+  reach(sides_[1], end, 0, -1);
+
+  // Best known route length (mu) and the vertex where it goes through
+  unsigned long long best = ULLONG_MAX;
+  Alias::node_index meet = size;
+  size_t side_index = 1;
+  while (!sides_[0].queue.empty() || !sides_[1].queue.empty()) {
+    // Standard criterion - no route through unsettled vertices can be shorter
+    unsigned long long lower_bound = 0;
+    for (const Side& side : sides_) {
+      lower_bound += side.queue.empty() ? UINT_MAX : side.queue.top().first;
+    }
+    if (lower_bound >= best) break;
+
+    // Alternate directions, skip a side which ran out of vertices
+    side_index ^= 1;
+    if (sides_[side_index].queue.empty()) side_index ^= 1;
+    Side& side = sides_[side_index];
+    const Side& other = sides_[side_index ^ 1];
+    const CsrGraph& edges = (side_index == 0 || symmetric_) ? forward_
+                                                            : backward_;
+
+    auto [current_distance, current_node] = side.queue.top();
+    side.queue.pop();
+    if (side.settled[current_node]) continue;
+    side.settled[current_node] = true;
+    settled_count_++;
+
+    for (size_t edge = edges.begin(current_node);
+         edge < edges.end(current_node); ++edge) {
+      const Alias::node_index i_neighbor = edges.target(edge);
+      const Alias::distance perspective_distance =
+          current_distance + edges.weight(edge);
+      if (perspective_distance < distance_of(side, i_neighbor)) {
+        reach(side, i_neighbor, perspective_distance,
+              static_cast<int>(current_node));
+      }
+      // Vertex reached by both searches joins their trees into a route
+      const Alias::distance other_distance = distance_of(other, i_neighbor);
+      if (other_distance == UINT_MAX) continue;
+      const unsigned long long route_distance =
+          static_cast<unsigned long long>(distance_of(side, i_neighbor)) +
+          other_distance;
+      if (route_distance < best) {
+        best = route_distance;
+        meet = i_neighbor;
+      }
+    }
+  }
+
+  if (meet == size) return {UINT_MAX, {}};
+  return {static_cast<Alias::distance>(best), unpack_route(meet)};
+}
+
+Alias::IntRow BidirectionalDijkstra::unpack_route(
+    const Alias::node_index a_meet) const {
+  Alias::IntRow result;
+  for (int at = a_meet; at != -1; at = sides_[0].prev_nodes[at])
+    result.push_back(at + 1);
+  std::reverse(result.begin(), result.end());
+  for (int at = sides_[1].prev_nodes[a_meet]; at != -1;
+       at = sides_[1].prev_nodes[at])
+    result.push_back(at + 1);
+  return result;
+}
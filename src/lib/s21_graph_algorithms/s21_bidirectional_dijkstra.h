@@ -0,0 +1,112 @@
+/**
+ * @file s21_bidirectional_dijkstra.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Bidirectional Dijkstra's algorithm for point-to-point queries
+ */
+
+#ifndef S21_BIDIRECTIONAL_DIJKSTRA_H
+#define S21_BIDIRECTIONAL_DIJKSTRA_H
+
+#include <array>
+
+#include "s21_csr_graph.h"
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class BidirectionalDijkstra
+ * @brief Point-to-point search growing frontiers from both ends
+ *
+ * Forward search walks outgoing edges from the source, backward search walks
+ * incoming edges from the target. Both are kept as CSR arrays built once per
+ * graph; for symmetric graphs the backward search reuses the forward arrays.
+ * Search buffers are reused between queries.
+ */
+class BidirectionalDijkstra {
+ public:
+  /**
+   * @brief Prepares adjacency arrays of graph
+   * @param[in] a_graph Input graph
+   */
+  explicit BidirectionalDijkstra(const Graph& a_graph);
+
+  ~BidirectionalDijkstra() = default;  ///< Default destructor
+
+  /**
+   * @brief Finds shortest route between two vertices
+   * @param[in] a_vertex1 Source vertex (numeration from 1)
+   * @param[in] a_vertex2 Target vertex (numeration from 1)
+   * @return RouteResult like GraphAlgorithms::GetShortestRouteBetweenVertices
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  RouteResult FindRoute(const int a_vertex1, const int a_vertex2);
+
+  /**
+   * @brief Gets number of vertices settled by the last query (both sides)
+   * @return Settled vertices count
+   */
+  size_t get_settled_count() const { return settled_count_; }
+
+  /**
+   * @brief Checks if the backward search reuses forward arrays
+   * @return true if the graph matrix is symmetric
+   */
+  bool is_symmetric() const { return symmetric_; }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  /// Heap entry - distance, vertex
+  using QueueItem = std::pair<Alias::distance, Alias::node_index>;
+  /// Min-heap of one search side
+  using Queue = std::priority_queue<QueueItem, std::vector<QueueItem>,
+                                    std::greater<QueueItem>>;
+
+  /**
+   * @brief Search state of one direction
+   */
+  struct Side {
+    std::vector<Alias::distance> distances;  ///< Tentative distances
+    std::vector<int> prev_nodes;             ///< Previous node on the side
+    std::vector<unsigned> stamps;            ///< Query that wrote the vertex
+    std::vector<bool> settled;               ///< Settled in current query
+    Queue queue;                             ///< Frontier
+  };
+
+  CsrGraph forward_;             ///< Outgoing edges
+  CsrGraph backward_;            ///< Incoming edges, empty if symmetric
+  bool symmetric_;               ///< Backward search uses forward_
+  std::array<Side, 2> sides_;    ///< Forward and backward search states
+  unsigned query_stamp_ = 0;     ///< Current query number
+  size_t settled_count_ = 0;     ///< Settled vertices in last query
+
+  /**
+   * @brief Gets distance of vertex written in current query
+   * @param[in] a_side Search side
+   * @param[in] a_vertex Vertex index
+   * @return Tentative distance or UINT_MAX
+   */
+  Alias::distance distance_of(const Side& a_side,
+                              const Alias::node_index a_vertex) const;
+
+  /**
+   * @brief Writes tentative distance of vertex in current query
+   * @param[in,out] a_side Search side
+   * @param[in] a_vertex Vertex index
+   * @param[in] a_distance New distance
+   * @param[in] a_prev Previous node
+   */
+  void reach(Side& a_side, const Alias::node_index a_vertex,
+             const Alias::distance a_distance, const int a_prev);
+
+  /**
+   * @brief Builds vertices of route through meeting vertex
+   * @param[in] a_meet Vertex where both searches met
+   * @return Vertices from source to target (numeration from 1)
+   */
+  Alias::IntRow unpack_route(const Alias::node_index a_meet) const;
+};
+
+#endif
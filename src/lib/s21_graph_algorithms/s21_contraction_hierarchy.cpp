@@ -0,0 +1,429 @@
+/**
+ * @file s21_contraction_hierarchy.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Contraction Hierarchies preprocessing and point-to-point queries
+ */
+
+#include "s21_contraction_hierarchy.h"
+
+namespace {
+
+/// First word of a hierarchy file
+const std::string ch_file_header = "CH";
+
+/**
+ * @brief Remaining graph while vertices are being contracted
+ */
+class Contraction {
+ public:
+  /// Arc with the middle vertex of a shortcut
+  struct Arc {
+    Alias::node_index target;
+    Alias::distance weight;
+    int middle;
+  };
+
+  explicit Contraction(const Graph& a_graph)
+      : out_(a_graph.get_graph_size()),
+        in_(a_graph.get_graph_size()),
+        contracted_neighbours_(a_graph.get_graph_size(), 0),
+        witness_distances_(a_graph.get_graph_size(), UINT_MAX),
+        witness_stamps_(a_graph.get_graph_size(), 0) {
+    const size_t size = a_graph.get_graph_size();
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < size; ++j) {
+        if (a_graph[i][j] == 0 || i == j) continue;
+        out_[i].push_back({j, static_cast<Alias::distance>(a_graph[i][j]), -1});
+        in_[j].push_back({i, static_cast<Alias::distance>(a_graph[i][j]), -1});
+      }
+    }
+  }
+
+  const std::vector<Arc>& out(Alias::node_index a_vertex) const {
+    return out_[a_vertex];
+  }
+  const std::vector<Arc>& in(Alias::node_index a_vertex) const {
+    return in_[a_vertex];
+  }
+
+  /// Edge difference plus contracted neighbours, smaller is contracted first
+  int priority(const Alias::node_index a_vertex) {
+    return contract(a_vertex, false) - static_cast<int>(in_[a_vertex].size()) -
+           static_cast<int>(out_[a_vertex].size()) +
+           contracted_neighbours_[a_vertex];
+  }
+
+  /// Counts shortcuts needed to remove vertex, removes it if a_apply is set
+  int contract(const Alias::node_index a_vertex, const bool a_apply) {
+    std::vector<std::pair<Alias::node_index, Arc>> shortcuts;
+    Alias::distance max_out = 0;
+    for (const Arc& arc : out_[a_vertex])
+      max_out = std::max(max_out, arc.weight);
+    for (const Arc& in_arc : in_[a_vertex]) {
+      const unsigned long long limit =
+          static_cast<unsigned long long>(in_arc.weight) + max_out;
+      witness_search(in_arc.target, a_vertex, limit);
+      for (const Arc& out_arc : out_[a_vertex]) {
+        if (out_arc.target == in_arc.target) continue;
+        const unsigned long long via =
+            static_cast<unsigned long long>(in_arc.weight) + out_arc.weight;
+        if (witness_distance(out_arc.target) <= via) continue;
+        shortcuts.push_back(
+            {in_arc.target, {out_arc.target, static_cast<Alias::distance>(via),
+                             static_cast<int>(a_vertex)}});
+      }
+    }
+    if (!a_apply) return static_cast<int>(shortcuts.size());
+
+    for (const auto& [from, arc] : shortcuts) {
+      add_arc(out_[from], arc);
+      add_arc(in_[arc.target], {from, arc.weight, arc.middle});
+    }
+    for (const Arc& arc : in_[a_vertex]) {
+      remove_arc(out_[arc.target], a_vertex);
+      contracted_neighbours_[arc.target]++;
+    }
+    for (const Arc& arc : out_[a_vertex]) {
+      remove_arc(in_[arc.target], a_vertex);
+      contracted_neighbours_[arc.target]++;
+    }
+    out_[a_vertex].clear();
+    in_[a_vertex].clear();
+    return static_cast<int>(shortcuts.size());
+  }
+
+ private:
+  std::vector<std::vector<Arc>> out_;
+  std::vector<std::vector<Arc>> in_;
+  std::vector<int> contracted_neighbours_;
+  std::vector<unsigned long long> witness_distances_;
+  std::vector<unsigned> witness_stamps_;
+  unsigned witness_stamp_ = 0;
+
+  static void add_arc(std::vector<Arc>& a_arcs, const Arc& a_arc) {
+    for (Arc& arc : a_arcs) {
+      if (arc.target != a_arc.target) continue;
+      if (a_arc.weight < arc.weight) arc = a_arc;
+      return;
+    }
+    a_arcs.push_back(a_arc);
+  }
+
+  static void remove_arc(std::vector<Arc>& a_arcs,
+                         const Alias::node_index a_target) {
+    std::erase_if(a_arcs, [a_target](const Arc& arc) {
+      return arc.target == a_target;
+    });
+  }
+
+  unsigned long long witness_distance(const Alias::node_index a_vertex) const {
+    return witness_stamps_[a_vertex] == witness_stamp_
+               ? witness_distances_[a_vertex]
+               : ULLONG_MAX;
+  }
+
+  /// Dijkstra from source avoiding excluded vertex, bounded by limit
+  void witness_search(const Alias::node_index a_source,
+                      const Alias::node_index a_excluded,
+                      const unsigned long long a_limit) {
+    using QueueItem = std::pair<unsigned long long, Alias::node_index>;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>>
+        queue_nodes;
+    if (++witness_stamp_ == 0) {
+      witness_stamps_.assign(witness_stamps_.size(), 0);
+      witness_stamp_ = 1;
+    }
+    witness_stamps_[a_source] = witness_stamp_;
+    witness_distances_[a_source] = 0;
+    queue_nodes.push({0, a_source});
+    size_t settled = 0;
+    while (!queue_nodes.empty() && settled < Tuning::witness_settle_limit) {
+      auto [current_distance, current_node] = queue_nodes.top();
+      queue_nodes.pop();
+      if (current_distance > a_limit) break;
+      if (current_distance != witness_distance(current_node)) continue;
+      settled++;
+      for (const Arc& arc : out_[current_node]) {
+        if (arc.target == a_excluded) continue;
+        const unsigned long long perspective_distance =
+            current_distance + arc.weight;
+        if (perspective_distance < witness_distance(arc.target)) {
+          witness_stamps_[arc.target] = witness_stamp_;
+          witness_distances_[arc.target] = perspective_distance;
+          queue_nodes.push({perspective_distance, arc.target});
+        }
+      }
+    }
+  }
+};
+
+}  // namespace
+
+ContractionHierarchy::ContractionHierarchy(const Graph& a_graph) {
+  const size_t size = a_graph.get_graph_size();
+  Contraction contraction(a_graph);
+  std::vector<std::vector<Arc>> up_lists(size);
+  std::vector<std::vector<Arc>> down_lists(size);
+  ranks_.assign(size, 0);
+
+  using QueueItem = std::pair<int, Alias::node_index>;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>>
+      queue_nodes;
+  for (size_t v = 0; v < size; ++v)
+    queue_nodes.push({contraction.priority(v), v});
+  size_t rank = 0;
+  while (!queue_nodes.empty()) {
+    const Alias::node_index current_node = queue_nodes.top().second;
+    queue_nodes.pop();
+    // Lazy update - priority may have grown since the vertex was pushed
+    const int current_priority = contraction.priority(current_node);
+    if (!queue_nodes.empty() && current_priority > queue_nodes.top().first) {
+      queue_nodes.push({current_priority, current_node});
+      continue;
+    }
+    ranks_[current_node] = rank++;
+    // Remaining neighbours are contracted later, so they rank higher
+    for (const auto& arc : contraction.out(current_node))
+      up_lists[current_node].push_back({arc.target, arc.weight, arc.middle});
+    for (const auto& arc : contraction.in(current_node))
+      down_lists[current_node].push_back({arc.target, arc.weight, arc.middle});
+    contraction.contract(current_node, true);
+  }
+  up_ = make_arcs(up_lists);
+  down_ = make_arcs(down_lists);
+  prepare_buffers();
+}
+
+ContractionHierarchy::Arcs ContractionHierarchy::make_arcs(
+    const std::vector<std::vector<Arc>>& a_lists) {
+  Arcs result;
+  result.offsets.assign(a_lists.size() + 1, 0);
+  for (size_t v = 0; v < a_lists.size(); ++v) {
+    result.arcs.insert(result.arcs.end(), a_lists[v].begin(), a_lists[v].end());
+    result.offsets[v + 1] = result.arcs.size();
+  }
+  return result;
+}
+
+void ContractionHierarchy::prepare_buffers() {
+  const size_t size = ranks_.size();
+  for (Side& side : sides_) {
+    side.distances.assign(size, UINT_MAX);
+    side.prev_nodes.assign(size, -1);
+    side.prev_arcs.assign(size, 0);
+    side.stamps.assign(size, 0);
+  }
+  query_stamp_ = 0;
+}
+
+size_t ContractionHierarchy::get_shortcuts_count() const {
+  size_t result = 0;
+  for (const Arcs* arcs : {&up_, &down_}) {
+    result += std::count_if(arcs->arcs.begin(), arcs->arcs.end(),
+                            [](const Arc& arc) { return arc.middle != -1; });
+  }
+  return result;
+}
+
+Alias::distance ContractionHierarchy::distance_of(
+    const Side& a_side, const Alias::node_index a_vertex) const {
+  return a_side.stamps[a_vertex] == query_stamp_ ? a_side.distances[a_vertex]
+                                                 : UINT_MAX;
+}
+
+RouteResult ContractionHierarchy::FindRoute(const int a_vertex1,
+                                            const int a_vertex2) {
+  const size_t size = ranks_.size();
+  if ((a_vertex1 <= 0 || static_cast<size_t>(a_vertex1) > size) ||
+      (a_vertex2 <= 0 || static_cast<size_t>(a_vertex2) > size))
+    throw std::invalid_argument("Invalid vertex value");
+  const Alias::node_index start = a_vertex1 - 1;
+  const Alias::node_index end = a_vertex2 - 1;
+  settled_count_ = 0;
+  if (start == end) return {0, {a_vertex1}};
+
+  if (++query_stamp_ == 0) {
+    for (Side& side : sides_) side.stamps.assign(size, 0);
+    query_stamp_ = 1;
+  }
+  for (Side& side : sides_) side.queue = Queue();
+  const Alias::node_index sources[] = {start, end};
+  for (size_t i = 0; i < sides_.size(); ++i) {
+    sides_[i].stamps[sources[i]] = query_stamp_;
+    sides_[i].distances[sources[i]] = 0;
+    sides_[i].prev_nodes[sources[i]] = -1;
+    sides_[i].queue.push(std::make_pair(0, sources[i]));
+  }
+
+  unsigned long long best = ULLONG_MAX;
+  Alias::node_index meet = size;
+  size_t side_index = 1;
+  auto is_active = [&best](const Side& a_side) {
+    return !a_side.queue.empty() && a_side.queue.top().first < best;
+  };
+  // Upward searches can't stop on the sum of tops, each side runs until its
+  // frontier is not shorter than the best route
+  while (is_active(sides_[0]) || is_active(sides_[1])) {
+    side_index ^= 1;
+    if (!is_active(sides_[side_index])) side_index ^= 1;
+    Side& side = sides_[side_index];
+    const Side& other = sides_[side_index ^ 1];
+    const Arcs& arcs = side_index == 0 ? up_ : down_;
+
+    auto [current_distance, current_node] = side.queue.top();
+    side.queue.pop();
+    if (current_distance != distance_of(side, current_node)) continue;
+    settled_count_++;
+    const Alias::distance other_distance = distance_of(other, current_node);
+    if (other_distance != UINT_MAX &&
+        static_cast<unsigned long long>(current_distance) + other_distance <
+            best) {
+      best = static_cast<unsigned long long>(current_distance) + other_distance;
+      meet = current_node;
+    }
+
+    for (size_t i = arcs.offsets[current_node];
+         i < arcs.offsets[current_node + 1]; ++i) {
+      const Arc& arc = arcs.arcs[i];
+      const Alias::distance perspective_distance =
+          current_distance + arc.weight;
+      if (perspective_distance < distance_of(side, arc.target)) {
+        side.stamps[arc.target] = query_stamp_;
+        side.distances[arc.target] = perspective_distance;
+        side.prev_nodes[arc.target] = static_cast<int>(current_node);
+        side.prev_arcs[arc.target] = i;
+        side.queue.push(std::make_pair(perspective_distance, arc.target));
+      }
+    }
+  }
+
+  if (meet == size) return {UINT_MAX, {}};
+  RouteResult result{static_cast<Alias::distance>(best), {a_vertex1}};
+  // Forward arcs from source to meeting vertex
+  std::vector<Alias::node_index> forward_nodes;
+  for (int at = meet; at != -1; at = sides_[0].prev_nodes[at])
+    forward_nodes.push_back(at);
+  for (size_t i = forward_nodes.size() - 1; i > 0; --i) {
+    const Alias::node_index head = forward_nodes[i - 1];
+    unpack_arc(forward_nodes[i], up_.arcs[sides_[0].prev_arcs[head]],
+               result.vertices);
+  }
+  // Backward arcs are stored reversed - down_[v] keeps w of edge w -> v
+  for (int at = meet; sides_[1].prev_nodes[at] != -1;
+       at = sides_[1].prev_nodes[at]) {
+    const Arc& arc = down_.arcs[sides_[1].prev_arcs[at]];
+    unpack_arc(at, {static_cast<Alias::node_index>(sides_[1].prev_nodes[at]),
+                    arc.weight, arc.middle},
+               result.vertices);
+  }
+  return result;
+}
+
+const ContractionHierarchy::Arc& ContractionHierarchy::find_arc(
+    const Arcs& a_arcs, const Alias::node_index a_from,
+    const Alias::node_index a_to) {
+  auto first = a_arcs.arcs.begin() + a_arcs.offsets[a_from];
+  auto last = a_arcs.arcs.begin() + a_arcs.offsets[a_from + 1];
+  return *std::find_if(first, last,
+                       [a_to](const Arc& arc) { return arc.target == a_to; });
+}
+
+bool ContractionHierarchy::has_valid_shortcuts() const {
+  auto has_arc = [](const Arcs& a_arcs, const Alias::node_index a_from,
+                    const Alias::node_index a_to) {
+    auto first = a_arcs.arcs.begin() + a_arcs.offsets[a_from];
+    auto last = a_arcs.arcs.begin() + a_arcs.offsets[a_from + 1];
+    return std::any_of(first, last,
+                       [a_to](const Arc& arc) { return arc.target == a_to; });
+  };
+  auto valid = [&](const Alias::node_index a_from,
+                   const Alias::node_index a_to, const int a_middle) {
+    if (a_middle == -1) return true;
+    const Alias::node_index middle = a_middle;
+    return ranks_[middle] < ranks_[a_from] && ranks_[middle] < ranks_[a_to] &&
+           has_arc(down_, middle, a_from) && has_arc(up_, middle, a_to);
+  };
+  for (Alias::node_index v = 0; v < ranks_.size(); ++v) {
+    for (size_t i = up_.offsets[v]; i < up_.offsets[v + 1]; ++i) {
+      if (!valid(v, up_.arcs[i].target, up_.arcs[i].middle)) return false;
+    }
+    // down_[v] keeps w of edge w -> v
+    for (size_t i = down_.offsets[v]; i < down_.offsets[v + 1]; ++i) {
+      if (!valid(down_.arcs[i].target, v, down_.arcs[i].middle)) return false;
+    }
+  }
+  return true;
+}
+
+void ContractionHierarchy::unpack_arc(const Alias::node_index a_from,
+                                      const Arc& a_arc,
+                                      Alias::IntRow& a_route) const {
+  if (a_arc.middle == -1) {
+    a_route.push_back(a_arc.target + 1);
+    return;
+  }
+  // Middle vertex was contracted before both ends of the shortcut
+  const Alias::node_index middle = a_arc.middle;
+  const Arc& first = find_arc(down_, middle, a_from);
+  unpack_arc(a_from, {middle, first.weight, first.middle}, a_route);
+  unpack_arc(middle, find_arc(up_, middle, a_arc.target), a_route);
+}
+
+void ContractionHierarchy::SaveToFile(const std::string& a_filename) const {
+  std::ofstream file(a_filename);
+  if (!file) {
+    throw std::invalid_argument("Cannot write to file: " + a_filename);
+  }
+  file << ch_file_header << Serialize::tab_symb << ranks_.size()
+       << Serialize::tab_symb << up_.arcs.size() << Serialize::tab_symb
+       << down_.arcs.size() << Serialize::new_line;
+  for (size_t rank : ranks_) file << rank << Serialize::tab_symb;
+  file << Serialize::new_line;
+  for (const Arcs* arcs : {&up_, &down_}) {
+    for (size_t offset : arcs->offsets) file << offset << Serialize::tab_symb;
+    file << Serialize::new_line;
+    for (const Arc& arc : arcs->arcs) {
+      file << arc.target << Serialize::tab_symb << arc.weight
+           << Serialize::tab_symb << arc.middle << Serialize::new_line;
+    }
+  }
+  file.close();
+}
+
+ContractionHierarchy ContractionHierarchy::LoadFromFile(
+    const std::string& a_filename) {
+  ContractionHierarchy result;
+  std::ifstream file(a_filename);
+  std::string header;
+  size_t size{0}, up_count{0}, down_count{0};
+  if (!(file >> header >> size >> up_count >> down_count) ||
+      header != ch_file_header) {
+    throw std::invalid_argument("Cannot load hierarchy from file: " +
+                                a_filename);
+  }
+  result.ranks_.resize(size);
+  for (size_t& rank : result.ranks_) file >> rank;
+  bool valid = static_cast<bool>(file);
+  for (auto [arcs, count] : {std::make_pair(&result.up_, up_count),
+                             std::make_pair(&result.down_, down_count)}) {
+    arcs->offsets.resize(size + 1);
+    arcs->arcs.resize(count);
+    for (size_t& offset : arcs->offsets) file >> offset;
+    for (Arc& arc : arcs->arcs) file >> arc.target >> arc.weight >> arc.middle;
+    valid = valid && file && arcs->offsets.front() == 0 &&
+            arcs->offsets.back() == count &&
+            std::is_sorted(arcs->offsets.begin(), arcs->offsets.end()) &&
+            std::all_of(arcs->arcs.begin(), arcs->arcs.end(),
+                        [size](const Arc& arc) {
+                          return arc.target < size && arc.middle >= -1 &&
+                                 arc.middle < static_cast<int>(size);
+                        });
+  }
+  if (!valid || !result.has_valid_shortcuts()) {
+    throw std::invalid_argument("Cannot load hierarchy from file: " +
+                                a_filename);
+  }
+  result.prepare_buffers();
+  return result;
+}
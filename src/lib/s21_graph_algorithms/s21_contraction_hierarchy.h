@@ -0,0 +1,178 @@
+/**
+ * @file s21_contraction_hierarchy.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Contraction Hierarchies preprocessing and point-to-point queries
+ */
+
+#ifndef S21_CONTRACTION_HIERARCHY_H
+#define S21_CONTRACTION_HIERARCHY_H
+
+#include <array>
+#include <fstream>
+#include <string>
+
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class ContractionHierarchy
+ * @brief Vertex hierarchy with shortcuts for fast shortest route queries
+ *
+ * Vertices are contracted one by one in order of edge difference (shortcuts
+ * added minus edges removed, plus contracted neighbours), kept up to date
+ * lazily. Contraction of v adds shortcut u -> w via v unless a witness search
+ * finds a path u -> w without v which is not longer. Upward arcs (to higher
+ * ranked vertices) and reversed downward arcs are stored in CSR form. Query
+ * runs two upward searches and unpacks shortcuts of the best meeting route.
+ */
+class ContractionHierarchy {
+ public:
+  /**
+   * @brief Contracts every vertex of graph
+   * @param[in] a_graph Input graph
+   */
+  explicit ContractionHierarchy(const Graph& a_graph);
+
+  ~ContractionHierarchy() = default;  ///< Default destructor
+
+  /**
+   * @brief Loads hierarchy saved by SaveToFile
+   * @param[in] a_filename The name of the file to load hierarchy from
+   * @return ContractionHierarchy ready for queries
+   * @throws std::invalid_argument if file is missing or malformed, or a
+   * shortcut can not be unpacked
+   */
+  static ContractionHierarchy LoadFromFile(const std::string& a_filename);
+
+  /**
+   * @brief Saves hierarchy to a text file
+   * @param[in] a_filename The name of the file (e.g. graph file name + .ch)
+   * @throws std::invalid_argument if file cannot be written
+   */
+  void SaveToFile(const std::string& a_filename) const;
+
+  /**
+   * @brief Finds shortest route between two vertices
+   * @param[in] a_vertex1 Source vertex (numeration from 1)
+   * @param[in] a_vertex2 Target vertex (numeration from 1)
+   * @return RouteResult like GraphAlgorithms::GetShortestRouteBetweenVertices
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  RouteResult FindRoute(const int a_vertex1, const int a_vertex2);
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_vertices_count() const { return ranks_.size(); }
+
+  /**
+   * @brief Gets the number of shortcuts kept in the hierarchy
+   * @return Shortcuts count
+   */
+  size_t get_shortcuts_count() const;
+
+  /**
+   * @brief Gets number of vertices settled by the last query (both sides)
+   * @return Settled vertices count
+   */
+  size_t get_settled_count() const { return settled_count_; }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  /**
+   * @brief Arc of the hierarchy, shortcuts remember contracted vertex
+   */
+  struct Arc {
+    Alias::node_index target;  ///< Head of arc
+    Alias::distance weight;    ///< Arc weight
+    int middle;                ///< Contracted vertex, -1 for graph edges
+  };
+
+  /**
+   * @brief Arcs of every vertex in CSR form
+   */
+  struct Arcs {
+    std::vector<size_t> offsets;  ///< Arcs of v are [offsets[v], offsets[v+1])
+    std::vector<Arc> arcs;        ///< Arcs grouped by tail vertex
+  };
+
+  /// Heap entry - distance, vertex
+  using QueueItem = std::pair<Alias::distance, Alias::node_index>;
+  /// Min-heap of one search side
+  using Queue = std::priority_queue<QueueItem, std::vector<QueueItem>,
+                                    std::greater<QueueItem>>;
+
+  /**
+   * @brief Search state of one direction
+   */
+  struct Side {
+    std::vector<Alias::distance> distances;  ///< Tentative distances
+    std::vector<int> prev_nodes;             ///< Previous node on the side
+    std::vector<size_t> prev_arcs;           ///< Arc from previous node
+    std::vector<unsigned> stamps;            ///< Query that wrote the vertex
+    Queue queue;                             ///< Frontier
+  };
+
+  std::vector<size_t> ranks_;    ///< Contraction order of vertices
+  Arcs up_;                      ///< v -> w with rank of w above rank of v
+  Arcs down_;                    ///< v <- w with rank of w above rank of v
+  std::array<Side, 2> sides_;    ///< Forward and backward search states
+  unsigned query_stamp_ = 0;     ///< Current query number
+  size_t settled_count_ = 0;     ///< Settled vertices in last query
+
+  ContractionHierarchy() = default;  ///< Empty hierarchy for loading
+
+  /**
+   * @brief Packs arc lists into CSR form
+   * @param[in] a_lists Arcs of every vertex
+   * @return Arcs
+   */
+  static Arcs make_arcs(const std::vector<std::vector<Arc>>& a_lists);
+
+  /**
+   * @brief Allocates query buffers
+   */
+  void prepare_buffers();
+
+  /**
+   * @brief Gets distance of vertex written in current query
+   * @param[in] a_side Search side
+   * @param[in] a_vertex Vertex index
+   * @return Tentative distance or UINT_MAX
+   */
+  Alias::distance distance_of(const Side& a_side,
+                              const Alias::node_index a_vertex) const;
+
+  /**
+   * @brief Finds arc between two vertices
+   * @param[in] a_arcs up_ or down_
+   * @param[in] a_from Tail vertex of CSR group
+   * @param[in] a_to Head of arc
+   * @return Arc
+   */
+  static const Arc& find_arc(const Arcs& a_arcs, const Alias::node_index a_from,
+                             const Alias::node_index a_to);
+
+  /**
+   * @brief Checks that every shortcut unpacks into arcs of the hierarchy
+   * @details Middle vertex m of shortcut f -> t needs arcs f -> m in down_
+   * and m -> t in up_, and a rank below both ends, so unpacking ends
+   * @return true if all shortcuts are valid
+   */
+  bool has_valid_shortcuts() const;
+
+  /**
+   * @brief Appends vertices of arc (without its tail) replacing shortcuts
+   * @param[in] a_from Tail of arc
+   * @param[in] a_arc Arc
+   * @param[out] a_route Route vertices (numeration from 1)
+   */
+  void unpack_arc(const Alias::node_index a_from, const Arc& a_arc,
+                  Alias::IntRow& a_route) const;
+};
+
+#endif
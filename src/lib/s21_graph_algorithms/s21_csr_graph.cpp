@@ -0,0 +1,54 @@
+/**
+ * @file s21_csr_graph.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Compressed sparse row form of the adjacency matrix
+ */
+
+#include "s21_csr_graph.h"
+
+CsrGraph CsrGraph::FromGraph(const Graph& a_graph) {
+  const size_t size = a_graph.get_graph_size();
+  CsrGraph result;
+  result.offsets_.assign(size + 1, 0);
+  for (size_t i = 0; i < size; ++i) {
+    const Alias::IntRow& row = a_graph[i];
+    for (size_t j = 0; j < size; ++j) {
+      if (row[j] != 0 && i != j) {
+        result.targets_.push_back(j);
+        result.weights_.push_back(row[j]);
+      }
+    }
+    result.offsets_[i + 1] = result.targets_.size();
+  }
+  return result;
+}
+
+CsrGraph CsrGraph::Transposed(const Graph& a_graph) {
+  const size_t size = a_graph.get_graph_size();
+  CsrGraph result;
+  // First pass - in-degrees, second pass - scatter edges to their columns
+  result.offsets_.assign(size + 1, 0);
+  for (size_t i = 0; i < size; ++i) {
+    const Alias::IntRow& row = a_graph[i];
+    for (size_t j = 0; j < size; ++j) {
+      if (row[j] != 0 && i != j) result.offsets_[j + 1]++;
+    }
+  }
+  for (size_t j = 0; j < size; ++j)
+    result.offsets_[j + 1] += result.offsets_[j];
+  result.targets_.resize(result.offsets_[size]);
+  result.weights_.resize(result.offsets_[size]);
+  std::vector<size_t> position(result.offsets_.begin(),
+                               result.offsets_.end() - 1);
+  for (size_t i = 0; i < size; ++i) {
+    const Alias::IntRow& row = a_graph[i];
+    for (size_t j = 0; j < size; ++j) {
+      if (row[j] != 0 && i != j) {
+        result.targets_[position[j]] = i;
+        result.weights_[position[j]++] = row[j];
+      }
+    }
+  }
+  return result;
+}
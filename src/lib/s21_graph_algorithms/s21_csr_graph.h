@@ -0,0 +1,109 @@
+/**
+ * @file s21_csr_graph.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Compressed sparse row form of the adjacency matrix
+ */
+
+#ifndef S21_CSR_GRAPH_H
+#define S21_CSR_GRAPH_H
+
+#include <vector>
+
+#include "../s21_graph/s21_graph.h"
+
+/**
+ * @class CsrGraph
+ * @brief Read-only adjacency arrays built from a Graph
+ *
+ * Edges of vertex v are stored at indexes [begin(v), end(v)) of the target
+ * and weight arrays. Zero cells and loops of the matrix are not edges.
+ */
+class CsrGraph {
+ public:
+  CsrGraph() = default;   ///< Default constructor
+  ~CsrGraph() = default;  ///< Default destructor
+
+  /**
+   * @brief Builds outgoing edges of every vertex (rows of the matrix)
+   * @param[in] a_graph Input graph
+   * @return CsrGraph with graph[v][u] as edge v -> u
+   */
+  static CsrGraph FromGraph(const Graph& a_graph);
+
+  /**
+   * @brief Builds incoming edges of every vertex (columns of the matrix)
+   * @param[in] a_graph Input graph
+   * @details The matrix is still read row by row, so no column walks happen
+   * @return CsrGraph with graph[u][v] as edge v -> u
+   */
+  static CsrGraph Transposed(const Graph& a_graph);
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_vertices_count() const {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+
+  /**
+   * @brief Gets the number of edges
+   * @return Number of edges
+   */
+  size_t get_edges_count() const { return targets_.size(); }
+
+  /**
+   * @brief Gets the first edge of a vertex
+   * @param[in] a_vertex Vertex index
+   * @return Index of the first edge
+   */
+  size_t begin(const Alias::node_index a_vertex) const {
+    return offsets_[a_vertex];
+  }
+
+  /**
+   * @brief Gets the edge after the last edge of a vertex
+   * @param[in] a_vertex Vertex index
+   * @return Index after the last edge
+   */
+  size_t end(const Alias::node_index a_vertex) const {
+    return offsets_[a_vertex + 1];
+  }
+
+  /**
+   * @brief Gets the number of edges of a vertex
+   * @param[in] a_vertex Vertex index
+   * @return Vertex degree
+   */
+  size_t degree(const Alias::node_index a_vertex) const {
+    return end(a_vertex) - begin(a_vertex);
+  }
+
+  /**
+   * @brief Gets the vertex an edge leads to
+   * @param[in] a_edge Edge index
+   * @return Target vertex index
+   */
+  Alias::node_index target(const size_t a_edge) const {
+    return targets_[a_edge];
+  }
+
+  /**
+   * @brief Gets the weight of an edge
+   * @param[in] a_edge Edge index
+   * @return Edge weight
+   */
+  Alias::distance weight(const size_t a_edge) const { return weights_[a_edge]; }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  std::vector<size_t> offsets_;             ///< First edge of every vertex
+  std::vector<Alias::node_index> targets_;  ///< Target of every edge
+  std::vector<Alias::distance> weights_;    ///< Weight of every edge
+};
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * @file s21_dijkstra_rows.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Rows of the all pairs distance matrix by single source searches
+ */
+
+#include "s21_dijkstra_rows.h"
+
+#include <climits>
+
+DijkstraRows::DijkstraRows(const Graph& a_graph)
+    : edges_{CsrGraph::FromGraph(a_graph)}, negative_cycle_{false} {
+  const size_t size = edges_.get_vertices_count();
+  potentials_.assign(size, 0);
+  bool has_negative = false;
+  for (size_t edge = 0; edge < edges_.get_edges_count(); ++edge)
+    has_negative |= static_cast<int>(edges_.weight(edge)) < 0;
+  if (!has_negative) return;
+  // Paths from the virtual vertex have at most size edges after the first
+  for (size_t round = 0; round <= size; ++round) {
+    bool changed = false;
+    for (size_t from = 0; from < size; ++from) {
+      for (size_t edge = edges_.begin(from); edge < edges_.end(from); ++edge) {
+        const long long candidate =
+            potentials_[from] + static_cast<int>(edges_.weight(edge));
+        if (candidate < potentials_[edges_.target(edge)]) {
+          potentials_[edges_.target(edge)] = candidate;
+          changed = true;
+        }
+      }
+    }
+    if (!changed) return;
+  }
+  negative_cycle_ = true;
+}
+
+void DijkstraRows::FillRow(const size_t a_source, Search& a_search,
+                           Alias::IntRow& a_row) const {
+  const size_t size = get_size();
+  a_search.distances.assign(size, LLONG_MAX);
+  a_search.settled.assign(size, false);
+  a_search.queue_nodes = {};
+  a_search.distances[a_source] = 0;
+  a_search.queue_nodes.push(std::make_pair(0, a_source));
+  while (!a_search.queue_nodes.empty()) {
+    auto [current_distance, current_node] = a_search.queue_nodes.top();
+    a_search.queue_nodes.pop();
+    if (a_search.settled[current_node]) continue;
+    a_search.settled[current_node] = true;
+    for (size_t edge = edges_.begin(current_node);
+         edge < edges_.end(current_node); ++edge) {
+      const Alias::node_index i_neighbor = edges_.target(edge);
+      // Reduced weight, non-negative thanks to the potentials
+      const long long perspective_distance =
+          current_distance + static_cast<int>(edges_.weight(edge)) +
+          potentials_[current_node] - potentials_[i_neighbor];
+      if (perspective_distance < a_search.distances[i_neighbor]) {
+        a_search.distances[i_neighbor] = perspective_distance;
+        a_search.queue_nodes.push(
+            std::make_pair(perspective_distance, i_neighbor));
+      }
+    }
+  }
+  a_row.assign(size, 0);
+  for (size_t target = 0; target < size; ++target) {
+    if (a_search.distances[target] == LLONG_MAX) continue;
+    a_row[target] = static_cast<int>(a_search.distances[target] -
+                                     potentials_[a_source] +
+                                     potentials_[target]);
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file s21_dijkstra_rows.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Rows of the all pairs distance matrix by single source searches
+ */
+
+#ifndef S21_DIJKSTRA_ROWS_H
+#define S21_DIJKSTRA_ROWS_H
+
+#include <queue>
+#include <vector>
+
+#include "s21_csr_graph.h"
+
+/**
+ * @class DijkstraRows
+ * @brief Computes any row of the all pairs distance matrix on its own
+ *
+ * Keeps CSR edges of a graph and Johnson's potentials: Bellman-Ford from a
+ * virtual vertex joined to every vertex makes w(u, v) + p[u] - p[v]
+ * non-negative, so Dijkstra's algorithm works with negative weights and the
+ * potentials are taken back from the distances. Potentials stay zero when
+ * there are no negative weights. Rows have the format of
+ * GraphAlgorithms::GetShortestPathsBetweenAllVertices.
+ */
+class DijkstraRows {
+ public:
+  /**
+   * @brief Search buffers, one per thread
+   */
+  struct Search {
+    std::vector<long long> distances;  ///< Distances with reduced weights
+    std::vector<bool> settled;         ///< Settled vertices
+    /// Heap entry - distance, vertex
+    using QueueItem = std::pair<long long, Alias::node_index>;
+    /// Min-heap of the search
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>>
+        queue_nodes;
+  };
+
+  /**
+   * @brief Builds edges and potentials of graph
+   * @param[in] a_graph Input graph
+   */
+  explicit DijkstraRows(const Graph& a_graph);
+
+  ~DijkstraRows() = default;  ///< Default destructor
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_size() const { return edges_.get_vertices_count(); }
+
+  /**
+   * @brief Checks if the graph has a negative cycle
+   * @details Rows are not computed then
+   * @return true if Bellman-Ford did not converge
+   */
+  bool has_negative_cycle() const { return negative_cycle_; }
+
+  /**
+   * @brief Computes one row of the distance matrix
+   * @param[in] a_source Source vertex index
+   * @param[in,out] a_search Buffers of the calling thread
+   * @param[out] a_row Path lengths from the source, 0 if there is no path
+   */
+  void FillRow(const size_t a_source, Search& a_search,
+               Alias::IntRow& a_row) const;
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  CsrGraph edges_;                     ///< Outgoing edges
+  std::vector<long long> potentials_;  ///< Johnson's potentials
+  bool negative_cycle_;                ///< Bellman-Ford did not converge
+};
+
+#endif
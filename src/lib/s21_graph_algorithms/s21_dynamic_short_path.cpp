@@ -0,0 +1,165 @@
+/**
+ * @file s21_dynamic_short_path.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Shortest path tree maintained under edge weight changes
+ */
+
+#include "s21_dynamic_short_path.h"
+
+DynamicShortPath::DynamicShortPath(const Graph& a_graph,
+                                   const int a_start_index)
+    : start_index_{a_start_index} {
+  Rebuild(a_graph);
+}
+
+void DynamicShortPath::Rebuild(const Graph& a_graph) {
+  const size_t size = a_graph.get_graph_size();
+  if (start_index_ < 0 || static_cast<size_t>(start_index_) >= size)
+    throw std::invalid_argument("Invalid vertex value");
+  path_ = GraphAlgorithms::GetShortPath(a_graph, start_index_);
+  out_.assign(size, {});
+  in_.assign(size, {});
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      if (a_graph[i][j] > 0) {
+        out_[i].push_back(j);
+        in_[j].push_back(i);
+      }
+    }
+  }
+  affected_.assign(size, false);
+  revision_ = a_graph.get_revision();
+  affected_count_ = 0;
+}
+
+void DynamicShortPath::UpdateEdge(const Graph& a_graph, const int a_from,
+                                  const int a_to, const int a_old_weight) {
+  const size_t size = a_graph.get_graph_size();
+  if (size != out_.size())
+    throw std::invalid_argument("Graph size differs from the tree");
+  if ((a_from < 0 || static_cast<size_t>(a_from) >= size) ||
+      (a_to < 0 || static_cast<size_t>(a_to) >= size))
+    throw std::invalid_argument("Invalid vertex value");
+  const int new_weight = a_graph[a_from][a_to];
+  const int old_weight = a_old_weight > 0 ? a_old_weight : 0;
+  if (old_weight > 0 && new_weight <= 0) {
+    Alias::IntRow& out = out_[a_from];
+    Alias::IntRow& in = in_[a_to];
+    const auto out_edge = std::find(out.begin(), out.end(), a_to);
+    const auto in_edge = std::find(in.begin(), in.end(), a_from);
+    // A wrong old weight or a second removal of the edge
+    if (out_edge == out.end() || in_edge == in.end())
+      throw std::invalid_argument("Removed edge is not in the graph");
+    out.erase(out_edge);
+    in.erase(in_edge);
+  }
+  revision_ = a_graph.get_revision();
+  affected_count_ = 0;
+  if (new_weight == old_weight) return;
+  if (old_weight == 0) {
+    out_[a_from].push_back(a_to);
+    in_[a_to].push_back(a_from);
+  }
+  if (a_from == a_to) return;
+  if (new_weight > 0 && (old_weight == 0 || new_weight < old_weight))
+    decrease(a_graph, a_from, a_to);
+  else
+    increase(a_graph, a_from, a_to);
+}
+
+void DynamicShortPath::decrease(const Graph& a_graph,
+                                const Alias::node_index a_from,
+                                const Alias::node_index a_to) {
+  std::vector<Alias::distance>& distances = path_.distances;
+  if (distances[a_from] == UINT_MAX) return;
+  const Alias::distance distance = distances[a_from] + a_graph[a_from][a_to];
+  if (distance >= distances[a_to]) return;
+  distances[a_to] = distance;
+  path_.prev_nodes[a_to] = a_from;
+  queue_.push({distance, a_to});
+  affected_count_ = settle(a_graph);
+}
+
+void DynamicShortPath::increase(const Graph& a_graph,
+                                const Alias::node_index a_from,
+                                const Alias::node_index a_to) {
+  std::vector<Alias::distance>& distances = path_.distances;
+  std::vector<int>& prev_nodes = path_.prev_nodes;
+  // Distances change only below a tree edge
+  if (prev_nodes[a_to] != static_cast<int>(a_from)) return;
+  // Release the subtree hanging on the edge
+  subtree_.assign(1, a_to);
+  affected_[a_to] = true;
+  for (size_t i = 0; i < subtree_.size(); ++i) {
+    const Alias::node_index vertex = subtree_[i];
+    for (int child : out_[vertex]) {
+      if (prev_nodes[child] == static_cast<int>(vertex) && !affected_[child]) {
+        affected_[child] = true;
+        subtree_.push_back(child);
+      }
+    }
+  }
+  // Keep vertices with an equally short parent outside of the released part.
+  // Weights are positive, so such a parent comes earlier in distance order.
+  std::sort(subtree_.begin(), subtree_.end(),
+            [&distances](Alias::node_index a, Alias::node_index b) {
+              return std::make_pair(distances[a], a) <
+                     std::make_pair(distances[b], b);
+            });
+  for (Alias::node_index vertex : subtree_) {
+    for (int parent : in_[vertex]) {
+      if (!affected_[parent] && distances[parent] != UINT_MAX &&
+          distances[parent] + a_graph[parent][vertex] == distances[vertex]) {
+        affected_[vertex] = false;
+        prev_nodes[vertex] = parent;
+        break;
+      }
+    }
+  }
+  // Settle the rest from their best parents in the kept tree
+  size_t released = 0;
+  for (Alias::node_index vertex : subtree_) {
+    if (!affected_[vertex]) continue;
+    subtree_[released++] = vertex;
+    distances[vertex] = UINT_MAX;
+    prev_nodes[vertex] = -1;
+  }
+  subtree_.resize(released);
+  for (Alias::node_index vertex : subtree_) {
+    for (int parent : in_[vertex]) {
+      if (affected_[parent] || distances[parent] == UINT_MAX) continue;
+      const Alias::distance distance =
+          distances[parent] + a_graph[parent][vertex];
+      if (distance < distances[vertex]) {
+        distances[vertex] = distance;
+        prev_nodes[vertex] = parent;
+      }
+    }
+    if (distances[vertex] != UINT_MAX)
+      queue_.push({distances[vertex], vertex});
+  }
+  for (Alias::node_index vertex : subtree_) affected_[vertex] = false;
+  settle(a_graph);
+  affected_count_ = released;
+}
+
+size_t DynamicShortPath::settle(const Graph& a_graph) {
+  std::vector<Alias::distance>& distances = path_.distances;
+  size_t settled = 0;
+  while (!queue_.empty()) {
+    const auto [distance, vertex] = queue_.top();
+    queue_.pop();
+    if (distance != distances[vertex]) continue;
+    settled++;
+    for (int neighbor : out_[vertex]) {
+      const Alias::distance candidate = distance + a_graph[vertex][neighbor];
+      if (candidate < distances[neighbor]) {
+        distances[neighbor] = candidate;
+        path_.prev_nodes[neighbor] = vertex;
+        queue_.push({candidate, neighbor});
+      }
+    }
+  }
+  return settled;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file s21_dynamic_short_path.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Shortest path tree maintained under edge weight changes
+ */
+
+#ifndef S21_DYNAMIC_SHORT_PATH_H
+#define S21_DYNAMIC_SHORT_PATH_H
+
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class DynamicShortPath
+ * @brief Full shortest path tree from one source, updated edge by edge
+ *
+ * After an edge weight changes (Graph::set_edge_weight) only the vertices
+ * whose distance depends on that edge are searched again, in the spirit of
+ * Ramalingam and Reps: a lowered edge starts a Dijkstra search from its
+ * target, a raised or removed tree edge releases the subtree below it, keeps
+ * the vertices which still have an equally short parent outside of it and
+ * settles the rest from the remaining tree.
+ */
+class DynamicShortPath {
+ public:
+  /**
+   * @brief Builds the tree with GraphAlgorithms::GetShortPath
+   * @param[in] a_graph Input graph
+   * @param[in] a_start_index Source vertex index
+   * @throws std::invalid_argument if the source is out of range
+   */
+  DynamicShortPath(const Graph& a_graph, const int a_start_index);
+
+  ~DynamicShortPath() = default;  ///< Default destructor
+
+  /**
+   * @brief Updates the tree after one edge weight change
+   * @param[in] a_graph Graph with the new weight already set
+   * @param[in] a_from Source vertex index of the edge
+   * @param[in] a_to Target vertex index of the edge
+   * @param[in] a_old_weight Weight before the change (returned by
+   * Graph::set_edge_weight), 0 if the edge was added
+   * @details Every change of the graph since the tree was built has to be
+   * passed here in order, otherwise use Rebuild
+   * @throws std::invalid_argument if a vertex is out of range, the graph
+   * size differs or a removed edge was not in the graph
+   */
+  void UpdateEdge(const Graph& a_graph, const int a_from, const int a_to,
+                  const int a_old_weight);
+
+  /**
+   * @brief Builds the tree from scratch
+   * @param[in] a_graph Input graph
+   * @throws std::invalid_argument if the source is out of range
+   */
+  void Rebuild(const Graph& a_graph);
+
+  /**
+   * @brief Gets the tree
+   * @return ShortPath like GraphAlgorithms::GetShortPath, ties may differ
+   */
+  const ShortPath& get_short_path() const { return path_; }
+
+  /**
+   * @brief Gets source vertex index
+   * @return Source vertex index
+   */
+  int get_start_index() const { return start_index_; }
+
+  /**
+   * @brief Gets graph revision the tree was last updated for
+   * @return Graph revision
+   */
+  unsigned long long get_revision() const { return revision_; }
+
+  /**
+   * @brief Gets number of vertices searched again by the last update
+   * @return Affected vertices count
+   */
+  size_t get_affected_count() const { return affected_count_; }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  /// Heap entry - distance, vertex
+  using QueueItem = std::pair<Alias::distance, Alias::node_index>;
+  /// Min-heap of the repair search
+  using Queue = std::priority_queue<QueueItem, std::vector<QueueItem>,
+                                    std::greater<QueueItem>>;
+
+  int start_index_;                         ///< Source vertex index
+  ShortPath path_;                          ///< Current tree
+  std::vector<Alias::IntRow> out_;          ///< Outgoing neighbors
+  std::vector<Alias::IntRow> in_;           ///< Incoming neighbors
+  unsigned long long revision_ = 0;         ///< Graph revision of the tree
+  size_t affected_count_ = 0;               ///< Searched by last update
+  std::vector<bool> affected_;              ///< Released, reset after use
+  std::vector<Alias::node_index> subtree_;  ///< Released vertices in order
+  Queue queue_;                             ///< Repair search frontier
+
+  /**
+   * @brief Repairs the tree after the edge got shorter or was added
+   * @param[in] a_graph Input graph
+   * @param[in] a_from Source vertex index of the edge
+   * @param[in] a_to Target vertex index of the edge
+   */
+  void decrease(const Graph& a_graph, const Alias::node_index a_from,
+                const Alias::node_index a_to);
+
+  /**
+   * @brief Repairs the tree after the edge got longer or was removed
+   * @param[in] a_graph Input graph
+   * @param[in] a_from Source vertex index of the edge
+   * @param[in] a_to Target vertex index of the edge
+   */
+  void increase(const Graph& a_graph, const Alias::node_index a_from,
+                const Alias::node_index a_to);
+
+  /**
+   * @brief Runs Dijkstra's search from the queued vertices
+   * @param[in] a_graph Input graph
+   * @return Number of settled vertices
+   */
+  size_t settle(const Graph& a_graph);
+};
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file s21_dynamic_span_tree.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Minimum spanning tree kept up to date under edge insertions
+ */
+
+#include "s21_dynamic_span_tree.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+DynamicSpanTree::DynamicSpanTree(const Graph& a_graph)
+    : size_{a_graph.get_graph_size()}, trees_{size_}, weights_(size_, 0) {
+  if (!a_graph.is_valid_graph() || size_ == 0)
+    throw std::invalid_argument("Invalid graph");
+  // A forest has at most size_ - 1 edges, one node for each
+  nodes_.resize(2 * size_ - 1);
+  edges_.resize(size_ - 1);
+  for (size_t node = nodes_.size(); node-- > size_;)
+    free_edges_.push_back(static_cast<int>(node));
+  std::vector<std::tuple<int, int, int>> edges;
+  for (size_t i = 0; i < size_; ++i) {
+    for (size_t j = i + 1; j < size_; ++j) {
+      if (a_graph[i][j] != a_graph[j][i])
+        throw std::invalid_argument("Graph is not undirected");
+      if (a_graph[i][j] != 0) edges.emplace_back(a_graph[i][j], i, j);
+    }
+  }
+  // Kruskal's algorithm, every edge joins two trees
+  std::sort(edges.begin(), edges.end());
+  for (const auto& [weight, from, to] : edges) {
+    if (!trees_.same(from, to)) AddEdge(from, to, weight);
+  }
+}
+
+bool DynamicSpanTree::AddEdge(const size_t a_from, const size_t a_to,
+                              const int a_weight) {
+  if (a_from >= size_ || a_to >= size_)
+    throw std::invalid_argument("Invalid vertex value");
+  if (a_weight == 0) throw std::invalid_argument("Invalid edge weight");
+  if (a_from == a_to) return false;
+  const int from = static_cast<int>(a_from), to = static_cast<int>(a_to);
+  const size_t from_tree = trees_.find(a_from), to_tree = trees_.find(a_to);
+  if (from_tree != to_tree) {
+    const long long weight = weights_[from_tree] + weights_[to_tree];
+    trees_.unite(from_tree, to_tree);
+    weights_[trees_.find(a_from)] = weight + a_weight;
+  } else {
+    // Heaviest edge of the cycle closed by the new one
+    make_root(from);
+    access(to);
+    const int heaviest = nodes_[to].heaviest;
+    const int heaviest_weight = edges_[heaviest - size_].weight;
+    if (heaviest_weight <= a_weight) return false;
+    cut(heaviest);
+    weights_[from_tree] += a_weight - heaviest_weight;
+  }
+  const int edge = free_edges_.back();
+  free_edges_.pop_back();
+  link(edge, from, to, a_weight);
+  return true;
+}
+
+SpanTree DynamicSpanTree::GetSpanTree() const {
+  std::vector<TreeEdge> edges;
+  edges.reserve(get_edges_count());
+  for (const Edge& edge : edges_) {
+    if (edge.from != -1) edges.push_back({edge.from, edge.to, edge.weight});
+  }
+  return SpanTree::FromEdges(size_, edges);
+}
+
+int DynamicSpanTree::get_tree_weight() {
+  return static_cast<int>(weights_[trees_.find(0)]);
+}
+
+bool DynamicSpanTree::is_splay_root(const int a_node) const {
+  const int parent = nodes_[a_node].parent;
+  return parent == -1 || (nodes_[parent].child[0] != a_node &&
+                          nodes_[parent].child[1] != a_node);
+}
+
+int DynamicSpanTree::heavier(const int a_left, const int a_right) const {
+  if (a_left == -1) return a_right;
+  if (a_right == -1) return a_left;
+  const int left = edges_[a_left - size_].weight;
+  const int right = edges_[a_right - size_].weight;
+  return std::tie(left, a_left) < std::tie(right, a_right) ? a_right : a_left;
+}
+
+void DynamicSpanTree::update(const int a_node) {
+  Node& node = nodes_[a_node];
+  // Vertices weigh nothing, only edge nodes can be the heaviest
+  node.heaviest = static_cast<size_t>(a_node) < size_ ? -1 : a_node;
+  for (const int child : node.child) {
+    if (child != -1)
+      node.heaviest = heavier(node.heaviest, nodes_[child].heaviest);
+  }
+}
+
+void DynamicSpanTree::push(const int a_node) {
+  Node& node = nodes_[a_node];
+  if (!node.reversed) return;
+  std::swap(node.child[0], node.child[1]);
+  for (const int child : node.child) {
+    if (child != -1) nodes_[child].reversed = !nodes_[child].reversed;
+  }
+  node.reversed = false;
+}
+
+void DynamicSpanTree::rotate(const int a_node) {
+  const int parent = nodes_[a_node].parent;
+  const int grandparent = nodes_[parent].parent;
+  const int side = nodes_[parent].child[1] == a_node;
+  if (!is_splay_root(parent))
+    nodes_[grandparent].child[nodes_[grandparent].child[1] == parent] = a_node;
+  nodes_[a_node].parent = grandparent;
+  const int moved = nodes_[a_node].child[!side];
+  nodes_[parent].child[side] = moved;
+  if (moved != -1) nodes_[moved].parent = parent;
+  nodes_[a_node].child[!side] = parent;
+  nodes_[parent].parent = a_node;
+  update(parent);
+  update(a_node);
+}
+
+void DynamicSpanTree::splay(const int a_node) {
+  // Pending reversals are pushed from the splay root down to the node
+  splay_path_.assign(1, a_node);
+  for (int node = a_node; !is_splay_root(node); node = nodes_[node].parent)
+    splay_path_.push_back(nodes_[node].parent);
+  for (auto node = splay_path_.rbegin(); node != splay_path_.rend(); ++node)
+    push(*node);
+  while (!is_splay_root(a_node)) {
+    const int parent = nodes_[a_node].parent;
+    if (!is_splay_root(parent)) {
+      const int grandparent = nodes_[parent].parent;
+      const bool zig_zig = (nodes_[grandparent].child[0] == parent) ==
+                           (nodes_[parent].child[0] == a_node);
+      rotate(zig_zig ? parent : a_node);
+    }
+    rotate(a_node);
+  }
+}
+
+void DynamicSpanTree::access(const int a_node) {
+  int last = -1;
+  for (int node = a_node; node != -1; node = nodes_[node].parent) {
+    splay(node);
+    nodes_[node].child[1] = last;
+    update(node);
+    last = node;
+  }
+  splay(a_node);
+}
+
+void DynamicSpanTree::make_root(const int a_node) {
+  access(a_node);
+  nodes_[a_node].reversed = !nodes_[a_node].reversed;
+}
+
+void DynamicSpanTree::link(const int a_edge, const int a_from, const int a_to,
+                           const int a_weight) {
+  edges_[a_edge - size_] = {a_from, a_to, a_weight};
+  nodes_[a_edge] = Node{};
+  nodes_[a_edge].heaviest = a_edge;
+  make_root(a_from);
+  nodes_[a_from].parent = a_edge;
+  make_root(a_edge);
+  nodes_[a_edge].parent = a_to;
+}
+
+void DynamicSpanTree::cut(const int a_edge) {
+  Edge& edge = edges_[a_edge - size_];
+  // The path from -> edge -> to is one splay tree of three nodes
+  make_root(edge.from);
+  access(edge.to);
+  splay(a_edge);
+  for (const int child : nodes_[a_edge].child) nodes_[child].parent = -1;
+  nodes_[a_edge] = Node{};
+  edge = Edge{};
+  free_edges_.push_back(a_edge);
+}
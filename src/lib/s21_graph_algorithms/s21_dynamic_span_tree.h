@@ -0,0 +1,178 @@
+/**
+ * @file s21_dynamic_span_tree.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Minimum spanning tree kept up to date under edge insertions
+ */
+
+#ifndef S21_DYNAMIC_SPAN_TREE_H
+#define S21_DYNAMIC_SPAN_TREE_H
+
+#include "../s21_disjoint_set/s21_disjoint_set.h"
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class DynamicSpanTree
+ * @brief Minimum spanning forest of an undirected graph which takes new and
+ * cheaper edges without a rebuild
+ *
+ * The forest is stored in a link-cut tree where every tree edge is a node
+ * between its two vertices, so the heaviest edge of a tree path is found in
+ * O(log V) amortized time. An edge closing a cycle replaces the heaviest
+ * edge of the cycle if it is lighter, an edge between two trees joins them.
+ * Trees only merge, the weight of every tree is kept in a disjoint set.
+ * Edge weights never grow: a tree edge added again with a heavier weight is
+ * left as it is. The graph is read only by the constructor.
+ */
+class DynamicSpanTree {
+ public:
+  /**
+   * @brief Builds minimum spanning forest of graph
+   * @param[in] a_graph Input graph with a symmetric matrix
+   * @throws std::invalid_argument if graph is invalid or not undirected
+   */
+  explicit DynamicSpanTree(const Graph& a_graph);
+
+  ~DynamicSpanTree() = default;  ///< Default destructor
+
+  /**
+   * @brief Adds edge or lowers its weight
+   * @param[in] a_from Vertex index
+   * @param[in] a_to Vertex index
+   * @param[in] a_weight Edge weight, not 0
+   * @details O(log V) amortized
+   * @return true if the edge entered the forest
+   * @throws std::invalid_argument if a vertex is out of range or weight is 0
+   */
+  bool AddEdge(const size_t a_from, const size_t a_to, const int a_weight);
+
+  /**
+   * @brief Gets minimum spanning tree of the tree of vertex 0
+   * @details O(V), the same tree as GraphAlgorithms::GetSpanTree up to
+   * edges of equal weight
+   * @return Spanning tree
+   */
+  SpanTree GetSpanTree() const;
+
+  /**
+   * @brief Gets weight of the tree of vertex 0
+   * @details O(1) amortized, equals GetSpanTree().tree_weight
+   * @return Tree weight
+   */
+  int get_tree_weight();
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_size() const { return size_; }
+
+  /**
+   * @brief Gets number of edges in the forest
+   * @return Edges count
+   */
+  size_t get_edges_count() const {
+    return edges_.size() - free_edges_.size();
+  }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  /**
+   * @brief Node of the link-cut tree, a vertex or a tree edge
+   */
+  struct Node {
+    int child[2] = {-1, -1};  ///< Children in the splay tree
+    int parent = -1;          ///< Splay parent, path parent for a splay root
+    bool reversed = false;    ///< Children of the subtree have to be swapped
+    int heaviest = -1;        ///< Heaviest edge node of the splay subtree
+  };
+
+  /**
+   * @brief Tree edge stored in an edge node
+   */
+  struct Edge {
+    int from = -1;   ///< Vertex index, -1 for a free node
+    int to = -1;     ///< Vertex index
+    int weight = 0;  ///< Edge weight
+  };
+
+  size_t size_;                     ///< Number of vertices
+  std::vector<Node> nodes_;         ///< Vertices, then edge nodes
+  std::vector<Edge> edges_;         ///< Edges of edge nodes, from size_ on
+  std::vector<int> free_edges_;     ///< Unused edge nodes
+  s21::disjoint_set trees_;         ///< Vertices by tree
+  std::vector<long long> weights_;  ///< Weight of a tree by its root
+  std::vector<int> splay_path_;     ///< Buffer of splay
+
+  /**
+   * @brief Checks if node is the root of its splay tree
+   * @param[in] a_node Node index
+   * @return true if the parent does not have it as a child
+   */
+  bool is_splay_root(const int a_node) const;
+
+  /**
+   * @brief Gets heavier of two edge nodes
+   * @param[in] a_left Edge node index or -1
+   * @param[in] a_right Edge node index or -1
+   * @return Node with the larger weight, then larger index
+   */
+  int heavier(const int a_left, const int a_right) const;
+
+  /**
+   * @brief Recomputes the heaviest edge of node's splay subtree
+   * @param[in] a_node Node index
+   */
+  void update(const int a_node);
+
+  /**
+   * @brief Passes pending reversal to the children
+   * @param[in] a_node Node index
+   */
+  void push(const int a_node);
+
+  /**
+   * @brief Rotates node above its splay parent
+   * @param[in] a_node Node index
+   */
+  void rotate(const int a_node);
+
+  /**
+   * @brief Moves node to the root of its splay tree
+   * @param[in] a_node Node index
+   */
+  void splay(const int a_node);
+
+  /**
+   * @brief Makes the path from the root to node preferred
+   * @param[in] a_node Node index, the root of its splay tree afterwards
+   */
+  void access(const int a_node);
+
+  /**
+   * @brief Makes node the root of its tree
+   * @param[in] a_node Node index
+   */
+  void make_root(const int a_node);
+
+  /**
+   * @brief Joins two trees by an edge node
+   * @param[in] a_edge Free edge node index
+   * @param[in] a_from Vertex index
+   * @param[in] a_to Vertex index of another tree
+   * @param[in] a_weight Edge weight
+   */
+  void link(const int a_edge, const int a_from, const int a_to,
+            const int a_weight);
+
+  /**
+   * @brief Removes edge node from the forest and frees it
+   * @param[in] a_edge Edge node index
+   */
+  void cut(const int a_edge);
+};
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ * @file s21_floyd_warshall.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Cache blocked Floyd-Warshall algorithm on a contiguous matrix
+ */
+
+#include "s21_floyd_warshall.h"
+
+#include <algorithm>
+
+#include "s21_simd_kernels.h"
+
+namespace {
+
+// Tile update of cells of type T, like FloydWarshall::update_tile
+template <typename T>
+using MinPlus = void (*)(T*, const T*, const T*, const size_t, const size_t,
+                         const size_t, const size_t);
+
+// Geometry of square tiles over a size x size matrix
+struct Tiles {
+  size_t size;    // Number of vertices
+  size_t stride;  // Row stride of the matrix
+  size_t tile;    // Tile size
+
+  size_t count() const { return (size + tile - 1) / tile; }
+  // Rows or columns of the tile with the given index
+  size_t extent(size_t a_index) const {
+    return std::min(tile, size - a_index * tile);
+  }
+  // Offset of the first cell of tile (a_row, a_column)
+  size_t offset(size_t a_row, size_t a_column) const {
+    return (a_row * stride + a_column) * tile;
+  }
+};
+
+// Blocked rounds, a_update(i, j, k) relaxes tile (i, j) through tiles (i, k)
+// and (k, j). The diagonal tile runs on the caller, tiles of the next two
+// phases on the pool
+template <typename Update>
+void run_blocked(const Tiles& a_tiles, s21::thread_pool& a_pool,
+                 Update a_update) {
+  const size_t tiles = a_tiles.count();
+  for (size_t k = 0; k < tiles; ++k) {
+    a_update(k, k, k);
+    a_pool.parallel_for(0, tiles, [&](size_t t, size_t) {
+      if (t == k) return;
+      a_update(k, t, k);
+      a_update(t, k, k);
+    });
+    a_pool.parallel_for(0, tiles * tiles, [&](size_t index, size_t) {
+      const size_t i = index / tiles, j = index % tiles;
+      if (i != k && j != k) a_update(i, j, k);
+    });
+  }
+}
+
+// Blocked rounds over cells of type T with a tile kernel
+template <typename T>
+void run_blocked(T* a_cells, const Tiles& a_tiles, MinPlus<T> a_kernel,
+                 s21::thread_pool& a_pool) {
+  run_blocked(a_tiles, a_pool, [&](size_t i, size_t j, size_t k) {
+    a_kernel(a_cells + a_tiles.offset(i, j), a_cells + a_tiles.offset(i, k),
+             a_cells + a_tiles.offset(k, j), a_tiles.stride,
+             a_tiles.extent(i), a_tiles.extent(j), a_tiles.extent(k));
+  });
+}
+
+// update_tile which also copies the hop to k into every improved cell
+template <typename Hop>
+void update_tile_hops(int* a_c, const int* a_a, const int* a_b, Hop* a_hops_c,
+                      const Hop* a_hops_a, const size_t a_stride,
+                      const size_t a_rows, const size_t a_columns,
+                      const size_t a_depth) {
+  const int infinity = DistanceMatrix::kInfinity;
+  for (size_t k = 0; k < a_depth; ++k) {
+    const int* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const int to_k = a_a[i * a_stride + k];
+      if (to_k == infinity) continue;
+      const Hop hop = a_hops_a[i * a_stride + k];
+      int* cells = a_c + i * a_stride;
+      Hop* hops = a_hops_c + i * a_stride;
+      for (size_t j = 0; j < a_columns; ++j) {
+        if (from_k[j] != infinity && to_k + from_k[j] < cells[j]) {
+          cells[j] = to_k + from_k[j];
+          hops[j] = hop;
+        }
+      }
+    }
+  }
+}
+
+// Blocked rounds over distances and hops stored as Hop
+template <typename Hop>
+void run_blocked_hops(DistanceMatrix& a_matrix, NextHopMatrix& a_hops,
+                      const Tiles& a_tiles, s21::thread_pool& a_pool) {
+  int* cells = a_matrix.row(0);
+  Hop* hops = a_hops.row<Hop>(0);
+  run_blocked(a_tiles, a_pool, [&](size_t i, size_t j, size_t k) {
+    const size_t c = a_tiles.offset(i, j), a = a_tiles.offset(i, k);
+    update_tile_hops(cells + c, cells + a, cells + a_tiles.offset(k, j),
+                     hops + c, hops + a, a_tiles.stride, a_tiles.extent(i),
+                     a_tiles.extent(j), a_tiles.extent(k));
+  });
+}
+
+}  // namespace
+
+DistanceMatrix::DistanceMatrix(const size_t a_size)
+    : size_{a_size},
+      stride_{(a_size + 15) / 16 * 16},
+      cells_(a_size * stride_, kInfinity) {
+  for (size_t i = 0; i < size_; ++i) row(i)[i] = 0;
+}
+
+DistanceMatrix DistanceMatrix::FromGraph(const Graph& a_graph) {
+  DistanceMatrix result(a_graph.get_graph_size());
+  for (size_t i = 0; i < result.size_; ++i) {
+    const Alias::IntRow& edges = a_graph[i];
+    int* cells = result.row(i);
+    for (size_t j = 0; j < result.size_; ++j) {
+      if (edges[j] != 0 && i != j) cells[j] = edges[j];
+    }
+  }
+  return result;
+}
+
+Alias::IntGrid DistanceMatrix::ToGrid() const {
+  Alias::IntGrid result{size_, Alias::IntRow(size_)};
+  for (size_t i = 0; i < size_; ++i) {
+    const int* cells = row(i);
+    for (size_t j = 0; j < size_; ++j)
+      result[i][j] = cells[j] == kInfinity ? 0 : cells[j];
+  }
+  return result;
+}
+
+void FloydWarshall::update_tile(int* a_c, const int* a_a, const int* a_b,
+                                const size_t a_stride, const size_t a_rows,
+                                const size_t a_columns, const size_t a_depth) {
+  const int infinity = DistanceMatrix::kInfinity;
+  for (size_t k = 0; k < a_depth; ++k) {
+    const int* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const int to_k = a_a[i * a_stride + k];
+      if (to_k == infinity) continue;
+      int* cells = a_c + i * a_stride;
+      for (size_t j = 0; j < a_columns; ++j) {
+        if (from_k[j] != infinity && to_k + from_k[j] < cells[j])
+          cells[j] = to_k + from_k[j];
+      }
+    }
+  }
+}
+
+FloydWarshall::CellWidth FloydWarshall::cell_width(
+    const DistanceMatrix& a_matrix) {
+  const size_t size = a_matrix.get_size();
+  long long max_weight = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const int* cells = a_matrix.row(i);
+    for (size_t j = 0; j < size; ++j) {
+      if (cells[j] < 0) return CellWidth::kChecked;
+      if (cells[j] != DistanceMatrix::kInfinity)
+        max_weight = std::max<long long>(max_weight, cells[j]);
+    }
+  }
+  // A shortest path has at most size - 1 edges
+  const long long longest = (static_cast<long long>(size) - 1) * max_weight;
+  if (longest < UINT16_MAX) return CellWidth::kUint16;
+  if (longest < Simd::saturated_infinity) return CellWidth::kInt32;
+  return CellWidth::kChecked;
+}
+
+void FloydWarshall::Run(DistanceMatrix& a_matrix, const size_t a_tile,
+                        s21::thread_pool& a_pool) {
+  Run(a_matrix, a_tile, cell_width(a_matrix), a_pool);
+}
+
+void FloydWarshall::Run(DistanceMatrix& a_matrix, const size_t a_tile,
+                        const CellWidth a_width, s21::thread_pool& a_pool) {
+  const size_t size = a_matrix.get_size();
+  const size_t stride = a_matrix.get_stride();
+  const Tiles tiles{size, stride, a_tile};
+  const int infinity = DistanceMatrix::kInfinity;
+  if (a_width == CellWidth::kChecked) {
+    run_blocked(a_matrix.row(0), tiles, update_tile, a_pool);
+  } else if (a_width == CellWidth::kInt32) {
+    for (size_t i = 0; i < size; ++i) {
+      int* cells = a_matrix.row(i);
+      std::replace(cells, cells + size, infinity, Simd::saturated_infinity);
+    }
+    run_blocked(a_matrix.row(0), tiles,
+                static_cast<MinPlus<int>>(Simd::min_plus), a_pool);
+    for (size_t i = 0; i < size; ++i) {
+      int* cells = a_matrix.row(i);
+      std::replace(cells, cells + size, Simd::saturated_infinity, infinity);
+    }
+  } else {
+    std::vector<uint16_t> narrow(size * stride, UINT16_MAX);
+    for (size_t i = 0; i < size; ++i) {
+      const int* cells = a_matrix.row(i);
+      for (size_t j = 0; j < size; ++j) {
+        if (cells[j] != infinity) narrow[i * stride + j] = cells[j];
+      }
+    }
+    run_blocked(narrow.data(), tiles,
+                static_cast<MinPlus<uint16_t>>(Simd::min_plus), a_pool);
+    for (size_t i = 0; i < size; ++i) {
+      int* cells = a_matrix.row(i);
+      for (size_t j = 0; j < size; ++j) {
+        const uint16_t cell = narrow[i * stride + j];
+        cells[j] = cell == UINT16_MAX ? infinity : cell;
+      }
+    }
+  }
+}
+
+NextHopMatrix FloydWarshall::RunWithNextHops(DistanceMatrix& a_matrix,
+                                             const size_t a_tile,
+                                             s21::thread_pool& a_pool) {
+  const size_t size = a_matrix.get_size();
+  NextHopMatrix hops(size, a_matrix.get_stride());
+  for (size_t i = 0; i < size; ++i) {
+    const int* cells = a_matrix.row(i);
+    for (size_t j = 0; j < size; ++j) {
+      if (cells[j] != DistanceMatrix::kInfinity) hops.set(i, j, j);
+    }
+  }
+  const Tiles tiles{size, a_matrix.get_stride(), a_tile};
+  switch (hops.get_cell_bytes()) {
+    case sizeof(uint8_t):
+      run_blocked_hops<uint8_t>(a_matrix, hops, tiles, a_pool);
+      break;
+    case sizeof(uint16_t):
+      run_blocked_hops<uint16_t>(a_matrix, hops, tiles, a_pool);
+      break;
+    default:
+      run_blocked_hops<uint32_t>(a_matrix, hops, tiles, a_pool);
+      break;
+  }
+  return hops;
+}
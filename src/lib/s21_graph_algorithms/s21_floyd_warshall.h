@@ -0,0 +1,181 @@
+/**
+ * @file s21_floyd_warshall.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Cache blocked Floyd-Warshall algorithm on a contiguous matrix
+ */
+
+#ifndef S21_FLOYD_WARSHALL_H
+#define S21_FLOYD_WARSHALL_H
+
+#include <climits>
+#include <vector>
+
+#include "../s21_graph/s21_graph.h"
+#include "../s21_thread_pool/s21_thread_pool.h"
+#include "s21_next_hop_matrix.h"
+
+/**
+ * @class DistanceMatrix
+ * @brief Square matrix of path lengths stored row by row in one buffer
+ *
+ * Rows are padded to a multiple of 16 cells (64 bytes), so vector loads at
+ * the end of a row stay inside its padding. Missing paths are kInfinity,
+ * padding cells are never read as paths.
+ */
+class DistanceMatrix {
+ public:
+  /// Length of a missing path
+  static constexpr int kInfinity = INT_MAX;
+
+  /**
+   * @brief Creates matrix without paths, zeros on the diagonal
+   * @param[in] a_size Number of vertices
+   */
+  explicit DistanceMatrix(const size_t a_size = 0);
+
+  ~DistanceMatrix() = default;  ///< Default destructor
+
+  /**
+   * @brief Creates matrix of direct edges
+   * @param[in] a_graph Input graph
+   * @details Zero cells are missing edges, loops are ignored
+   * @return Edge weights, kInfinity where there is no edge
+   */
+  static DistanceMatrix FromGraph(const Graph& a_graph);
+
+  /**
+   * @brief Converts matrix to the GetShortestPathsBetweenAllVertices format
+   * @return Path lengths, 0 where there is no path
+   */
+  Alias::IntGrid ToGrid() const;
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_size() const { return size_; }
+
+  /**
+   * @brief Gets distance between the starts of two neighbouring rows
+   * @return Row stride in cells
+   */
+  size_t get_stride() const { return stride_; }
+
+  /**
+   * @brief Gets row of the matrix
+   * @param[in] a_row Row index
+   * @return Pointer to the first cell of the row
+   */
+  int* row(const size_t a_row) { return cells_.data() + a_row * stride_; }
+
+  /**
+   * @brief Gets row of the matrix (const version)
+   * @param[in] a_row Row index
+   * @return Pointer to the first cell of the row
+   */
+  const int* row(const size_t a_row) const {
+    return cells_.data() + a_row * stride_;
+  }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  size_t size_;             ///< Number of vertices
+  size_t stride_;           ///< Row length with padding
+  std::vector<int> cells_;  ///< Row-major cells
+};
+
+/**
+ * @namespace FloydWarshall
+ * @brief All pairs shortest paths by tiles of the distance matrix
+ *
+ * Every round k takes tile row and tile column k as intermediate vertices:
+ * the diagonal tile is solved first, then the tiles of its row and column,
+ * then all other tiles from them. A tile is Tuning::floyd_warshall_tile
+ * cells wide, so the three tiles of one update stay in L1/L2 cache instead
+ * of streaming the whole matrix for every intermediate vertex. Tiles are
+ * relaxed by the branch free Simd::min_plus kernels on 16 or 32-bit cells
+ * whenever all paths fit them. Tiles of one phase never read each other, so
+ * they are spread over a thread pool without changing the result.
+ */
+namespace FloydWarshall {
+
+/**
+ * @enum CellWidth
+ * @brief Cells and tile kernel used by the rounds
+ */
+enum class CellWidth {
+  kUint16,  ///< 16-bit cells, Simd::min_plus with saturating adds
+  kInt32,   ///< 32-bit cells, Simd::min_plus with saturated_infinity
+  kChecked  ///< Matrix cells, update_tile with a branch per cell
+};
+
+/**
+ * @brief Picks the narrowest cells holding every path of the matrix
+ * @param[in] a_matrix Direct edges
+ * @details Bounds paths by (size - 1) * max weight. Negative weights and
+ * paths reaching Simd::saturated_infinity need kChecked
+ * @return Cell width
+ */
+CellWidth cell_width(const DistanceMatrix& a_matrix);
+
+/**
+ * @brief Replaces every path length with the shortest one
+ * @param[in,out] a_matrix Direct edges on input, shortest paths on output
+ * @param[in] a_tile Tile size in cells
+ * @param[in] a_pool Workers for the row, column and remaining tiles of every
+ * round, the result does not depend on their number
+ * @details Uses cell_width of the matrix
+ */
+void Run(DistanceMatrix& a_matrix, const size_t a_tile,
+         s21::thread_pool& a_pool = s21::thread_pool::shared());
+
+/**
+ * @brief Replaces every path length with the shortest one
+ * @param[in,out] a_matrix Direct edges on input, shortest paths on output
+ * @param[in] a_tile Tile size in cells
+ * @param[in] a_width Cell width, not narrower than cell_width of the matrix
+ * @param[in] a_pool Workers for the row, column and remaining tiles of every
+ * round, the result does not depend on their number
+ */
+void Run(DistanceMatrix& a_matrix, const size_t a_tile,
+         const CellWidth a_width,
+         s21::thread_pool& a_pool = s21::thread_pool::shared());
+
+/**
+ * @brief Replaces every path length with the shortest one and records hops
+ * @param[in,out] a_matrix Direct edges on input, shortest paths on output
+ * @param[in] a_tile Tile size in cells
+ * @param[in] a_pool Workers for the row, column and remaining tiles of every
+ * round, the result does not depend on their number
+ * @details Every improved cell takes the hop of the path to the intermediate
+ * vertex. Runs the checked kernel, hops are updated next to the distances
+ * @return Next hops of the shortest paths
+ */
+NextHopMatrix RunWithNextHops(
+    DistanceMatrix& a_matrix, const size_t a_tile,
+    s21::thread_pool& a_pool = s21::thread_pool::shared());
+
+/**
+ * @brief Relaxes tile C with paths through tile A then tile B
+ * @details For every k < a_depth, i < a_rows, j < a_columns sets
+ * c[i][j] = min(c[i][j], a[i][k] + b[k][j]) in k order. Tiles may overlap
+ * as in the diagonal, row and column phases.
+ * @param[in,out] a_c First cell of the updated tile
+ * @param[in] a_a First cell of the tile with paths to intermediate vertices
+ * @param[in] a_b First cell of the tile with paths from intermediate vertices
+ * @param[in] a_stride Row stride of the matrix
+ * @param[in] a_rows Rows of the updated tile
+ * @param[in] a_columns Columns of the updated tile
+ * @param[in] a_depth Number of intermediate vertices
+ */
+void update_tile(int* a_c, const int* a_a, const int* a_b,
+                 const size_t a_stride, const size_t a_rows,
+                 const size_t a_columns, const size_t a_depth);
+
+};  // namespace FloydWarshall
+
+#endif
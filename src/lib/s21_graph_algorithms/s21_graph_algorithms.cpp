@@ -14,6 +14,238 @@
 
 #include "s21_graph_algorithms.h"
 
+#include <mutex>
+
+namespace {
+
+// Edge density of the last measured graph revision. Revisions are unique in
+// the process, so queries on an unchanged graph skip the O(V^2) scan
+struct DensityCache {
+  std::mutex mutex;
+  unsigned long long revision = 0;
+  double density = 0.0;
+};
+
+DensityCache& density_cache() {
+  static DensityCache cache;
+  return cache;
+}
+
+// Converts the MST structure (prev_node array) to SpanTree
+SpanTree make_span_tree(const Graph& graph, const std::vector<int>& prev_node,
+                        const int mst_weight) {
+  SpanTree result{prev_node, {}, mst_weight};
+  for (size_t i = 0; i < prev_node.size(); i++) {
+    int u = prev_node[i];
+    int v = i;
+    if (u != -1) result.edges.push_back({u, v, graph[u][v]});
+  }
+  return result;
+}
+
+// Undirected edge of a spanning tree algorithm
+struct SpanEdge {
+  Alias::distance weight;
+  uint32_t from;
+  uint32_t to;
+};
+
+// Calls a_function(i, j, cell) for every non-zero cell above the diagonal,
+// false if the matrix is not symmetric
+template <typename Function>
+bool for_each_undirected_edge(const Graph& graph, Function a_function) {
+  const size_t size = graph.get_graph_size();
+  // Square blocks keep both a row part and the mirrored column part in cache
+  const size_t block = 64;
+  for (size_t block_i = 0; block_i < size; block_i += block) {
+    for (size_t block_j = block_i; block_j < size; block_j += block) {
+      const size_t end_i = std::min(block_i + block, size);
+      const size_t end_j = std::min(block_j + block, size);
+      for (size_t i = block_i; i < end_i; ++i) {
+        const Alias::IntRow& row = graph[i];
+        for (size_t j = std::max(block_j, i + 1); j < end_j; ++j) {
+          if (row[j] != graph[j][i]) return false;
+          if (row[j] != 0) a_function(i, j, row[j]);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// SpanTree of the forest edges lying in the tree of vertex 0 - Prim's
+// algorithm stops at the component of its start vertex
+SpanTree span_tree_from_edges(const size_t size,
+                              const std::vector<SpanEdge>& edges) {
+  std::vector<TreeEdge> tree_edges;
+  tree_edges.reserve(edges.size());
+  for (const SpanEdge& edge : edges) {
+    tree_edges.push_back({static_cast<int>(edge.from),
+                          static_cast<int>(edge.to),
+                          static_cast<int>(edge.weight)});
+  }
+  return SpanTree::FromEdges(size, tree_edges);
+}
+
+// Kruskal's algorithm over the component of vertex 0, false if the matrix
+// is not symmetric
+bool kruskal_span_tree(const Graph& graph, s21::thread_pool& pool,
+                       SpanTree& result) {
+  const size_t size = graph.get_graph_size();
+  std::vector<SpanEdge> edges;
+  const bool undirected =
+      for_each_undirected_edge(graph, [&](size_t i, size_t j, int cell) {
+        edges.push_back({static_cast<Alias::distance>(cell),
+                         static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+      });
+  if (!undirected) return false;
+  s21::radix_sort(
+      edges, [](const SpanEdge& edge) { return edge.weight; }, pool);
+
+  s21::disjoint_set trees(size);
+  std::vector<SpanEdge> tree_edges;
+  for (const SpanEdge& edge : edges) {
+    if (trees.unite(edge.from, edge.to)) tree_edges.push_back(edge);
+    if (tree_edges.size() + 1 == size) break;
+  }
+  result = span_tree_from_edges(size, tree_edges);
+  return true;
+}
+
+// Marks a missing lightest edge
+const uint32_t kNoEdge = UINT32_MAX;
+
+// Strict order of edges by weight, then endpoints. Equal weights would let
+// components pick edges of a cycle
+bool is_lighter(const SpanEdge& a, const SpanEdge& b) {
+  if (b.from == kNoEdge) return a.from != kNoEdge;
+  if (a.from == kNoEdge) return false;
+  const auto key = [](const SpanEdge& edge) {
+    return std::make_tuple(edge.weight, std::min(edge.from, edge.to),
+                           std::max(edge.from, edge.to));
+  };
+  return key(a) < key(b);
+}
+
+// Boruvka's algorithm, a_lightest(v, component) gives the lightest edge
+// from v to another component
+template <typename Lightest>
+SpanTree boruvka_span_tree(const size_t size, s21::thread_pool& pool,
+                           Lightest a_lightest, MstStats* stats) {
+  s21::concurrent_disjoint_set trees(size);
+  std::vector<uint32_t> component(size);
+  std::vector<SpanEdge> vertex_best(size), component_best(size);
+  std::vector<SpanEdge> tree_edges;
+  size_t rounds = 0;
+  while (true) {
+    pool.parallel_for(0, size, [&](size_t v, size_t) {
+      component[v] = static_cast<uint32_t>(trees.find(v));
+    });
+    pool.parallel_for(0, size, [&](size_t v, size_t) {
+      vertex_best[v] = a_lightest(v, component);
+    });
+    // Components of one vertex are the most, a serial pass is O(V)
+    for (size_t v = 0; v < size; ++v) component_best[v].from = kNoEdge;
+    bool found = false;
+    for (size_t v = 0; v < size; ++v) {
+      SpanEdge& best = component_best[component[v]];
+      if (is_lighter(vertex_best[v], best)) {
+        best = vertex_best[v];
+        found = true;
+      }
+    }
+    if (!found) break;
+    ++rounds;
+    std::vector<uint8_t> joined(size, 0);
+    pool.parallel_for(0, size, [&](size_t c, size_t) {
+      const SpanEdge& edge = component_best[c];
+      if (edge.from != kNoEdge) joined[c] = trees.unite(edge.from, edge.to);
+    });
+    for (size_t c = 0; c < size; ++c) {
+      if (joined[c]) tree_edges.push_back(component_best[c]);
+    }
+  }
+  if (stats) *stats = MstStats{rounds, tree_edges.size()};
+  return span_tree_from_edges(size, tree_edges);
+}
+
+// Dijkstra's algorithm over an integer priority queue with push(key, vertex),
+// top() -> (key, vertex) and pop(). The queue may pop equal keys in any
+// order, so an equally short path replaces the previous node when its tail
+// is smaller by (distance, index) - the one the binary heap settles first
+template <typename Queue>
+ShortPath short_path_on_queue(const Graph& graph, const int start_index,
+                              Queue& queue_nodes) {
+  ShortPath result;
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || start_index < 0 || static_cast<size_t>(start_index) >= size)
+    return result;
+  std::vector<bool> visited(size, false);
+  std::vector<Alias::distance> distance_array(size, UINT_MAX);
+  std::vector<int> prev_node(size, -1);
+  distance_array[start_index] = 0;
+  queue_nodes.push(0, start_index);
+
+  while (!queue_nodes.empty()) {
+    const auto [current_distance, current_node] = queue_nodes.top();
+    queue_nodes.pop();
+    if (visited[current_node]) continue;
+    visited[current_node] = true;
+    const Alias::IntRow& row = graph[current_node];
+    for (Alias::node_index i_neighbor = 0; i_neighbor < size; ++i_neighbor) {
+      const Alias::distance weight = row[i_neighbor];
+      if (weight == 0 || visited[i_neighbor]) continue;
+      const Alias::distance perspective_distance = current_distance + weight;
+      if (perspective_distance < distance_array[i_neighbor]) {
+        distance_array[i_neighbor] = perspective_distance;
+        prev_node[i_neighbor] = static_cast<int>(current_node);
+        queue_nodes.push(perspective_distance, i_neighbor);
+      } else if (perspective_distance == distance_array[i_neighbor]) {
+        // Queue pops equal distances in any order. Heap would settle the
+        // smallest (distance, index) pair first and keep it as previous node
+        const int prev = prev_node[i_neighbor];
+        if (current_distance < distance_array[prev] ||
+            (current_distance == distance_array[prev] &&
+             static_cast<int>(current_node) < prev))
+          prev_node[i_neighbor] = static_cast<int>(current_node);
+      }
+    }
+  }
+  result.distances = distance_array;
+  result.prev_nodes = prev_node;
+  return result;
+}
+
+/**
+ * @brief Search buffers of one worker of GetDistanceTable
+ */
+struct TableSearch {
+  std::vector<Alias::distance> distances;  // valid if stamps[v] == stamp
+  std::vector<unsigned> stamps;
+  std::vector<bool> settled;
+  unsigned stamp = 0;
+  using QueueItem = std::pair<Alias::distance, Alias::node_index>;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>>
+      queue_nodes;
+
+  Alias::distance distance_of(const Alias::node_index a_vertex) const {
+    return stamps[a_vertex] == stamp ? distances[a_vertex] : UINT_MAX;
+  }
+};
+
+// Calls a_function with a pool of a_threads workers, 0 - the shared pool
+template <typename Function>
+void with_thread_pool(const size_t a_threads, Function a_function) {
+  if (a_threads == 0) {
+    a_function(s21::thread_pool::shared());
+  } else {
+    s21::thread_pool pool(a_threads);
+    a_function(pool);
+  }
+}
+
+}  // namespace
+
 Alias::NodesPath GraphAlgorithms::DepthFirstSearch(const Graph& graph,
                                                    const int start_vertex) {
   s21::stack<int> stack_nodes;
@@ -27,7 +259,16 @@ Alias::NodesPath GraphAlgorithms::BreadthFirstSearch(const Graph& graph,
 }
 
 ShortPath GraphAlgorithms::GetShortPath(const Graph& graph,
-                                        const int start_index) {
+                                        const int start_index,
+                                        const int stop_index) {
+  if (is_dense_graph(graph))
+    return GetShortPathDense(graph, start_index, stop_index);
+  return GetShortPathHeap(graph, start_index, stop_index);
+}
+
+ShortPath GraphAlgorithms::GetShortPathHeap(const Graph& graph,
+                                            const int start_index,
+                                            const int stop_index) {
   ShortPath result;
   const size_t size = graph.get_graph_size();
   if (size == 0 || start_index < 0 || static_cast<size_t>(start_index) >= size)
@@ -61,6 +302,8 @@ ShortPath GraphAlgorithms::GetShortPath(const Graph& graph,
 
     if (visited[current_node]) continue;
     visited[current_node] = true;
+    // Distance and path to stop node are final - nothing else is needed
+    if (static_cast<int>(current_node) == stop_index) break;
 
     // Look every neighboors (i_neigh) of current_node
     for (Alias::node_index i_neighbor = 0; i_neighbor < size; ++i_neighbor) {
@@ -88,9 +331,152 @@ ShortPath GraphAlgorithms::GetShortPath(const Graph& graph,
   return result;
 }
 
-unsigned GraphAlgorithms::GetShortestPathBetweenVertices(const Graph& graph,
-                                                         const int vertex1,
-                                                         const int vertex2) {
+ShortPath GraphAlgorithms::GetShortPathDense(const Graph& graph,
+                                             const int start_index,
+                                             const int stop_index) {
+  ShortPath result;
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || start_index < 0 || static_cast<size_t>(start_index) >= size)
+    return result;
+  // Tentative distances of open nodes. Settled nodes get UINT_MAX here, so
+  // the next node is just the first minimum of the array
+  std::vector<Alias::distance> keys(size, UINT_MAX);
+  // 0 - open node, UINT_MAX - settled node. Used as a mask by relax_row
+  std::vector<Alias::distance> settled(size, 0);
+  std::vector<Alias::distance> distance_array(size, UINT_MAX);
+  std::vector<int> prev_node(size, -1);
+
+  keys[start_index] = 0;
+  for (size_t step = 0; step < size; ++step) {
+    const size_t current_node = Simd::argmin(keys.data(), size);
+    if (current_node == size) break;  // the rest is unreachable
+    distance_array[current_node] = keys[current_node];
+    keys[current_node] = UINT_MAX;
+    settled[current_node] = UINT_MAX;
+    if (static_cast<int>(current_node) == stop_index) break;
+    Simd::relax_row(graph[current_node].data(), settled.data(),
+                    distance_array[current_node],
+                    static_cast<int>(current_node), keys.data(),
+                    prev_node.data(), size);
+  }
+
+  result.distances = distance_array;
+  result.prev_nodes = prev_node;
+  return result;
+}
+
+ShortPath GraphAlgorithms::GetShortPathBuckets(const Graph& graph,
+                                               const int start_index,
+                                               Alias::distance max_weight) {
+  if (max_weight == 0) max_weight = max_edge_weight(graph);
+  s21::bucket_queue<Alias::node_index> queue_nodes(max_weight);
+  return short_path_on_queue(graph, start_index, queue_nodes);
+}
+
+ShortPath GraphAlgorithms::GetShortPathRadixHeap(const Graph& graph,
+                                                 const int start_index) {
+  s21::radix_heap<Alias::node_index> queue_nodes;
+  return short_path_on_queue(graph, start_index, queue_nodes);
+}
+
+ShortPath GraphAlgorithms::GetShortPathDeltaStepping(const Graph& graph,
+                                                     const int start_index,
+                                                     Alias::distance delta) {
+  ShortPath result;
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || start_index < 0 || static_cast<size_t>(start_index) >= size)
+    return result;
+  const CsrGraph edges = CsrGraph::FromGraph(graph);
+  Alias::distance max_weight = 0;
+  for (size_t edge = 0; edge < edges.get_edges_count(); ++edge)
+    max_weight = std::max(max_weight, edges.weight(edge));
+  if (delta == 0 && edges.get_edges_count() > 0)
+    delta = static_cast<Alias::distance>(std::max<unsigned long long>(
+        1, static_cast<unsigned long long>(max_weight) * size /
+               edges.get_edges_count()));
+  if (delta == 0) delta = 1;
+  // Tentative distances are at most max_weight ahead of the current bucket,
+  // so a ring of buckets is enough
+  const size_t bucket_count = max_weight / delta + 2;
+  std::vector<std::vector<Alias::node_index>> buckets(bucket_count);
+  std::vector<Alias::distance> distance_array(size, UINT_MAX);
+  // Last round a vertex was taken into the frontier / bucket it was settled in
+  std::vector<unsigned> round_stamps(size, 0);
+  std::vector<unsigned long long> settled_stamps(size, 0);
+
+  s21::thread_pool& pool = s21::thread_pool::shared();
+  // Relaxation requests - vertex, new distance. One buffer per worker
+  using Request = std::pair<Alias::node_index, Alias::distance>;
+  std::vector<std::vector<Request>> requests(pool.size());
+  size_t queued = 1;
+  distance_array[start_index] = 0;
+  buckets[0].push_back(start_index);
+
+  auto generate_requests = [&](const std::vector<Alias::node_index>& vertices,
+                               const bool light) {
+    pool.parallel_for(0, vertices.size(), [&](size_t i, size_t worker) {
+      const Alias::node_index current_node = vertices[i];
+      const Alias::distance current_distance = distance_array[current_node];
+      for (size_t edge = edges.begin(current_node);
+           edge < edges.end(current_node); ++edge) {
+        const Alias::distance weight = edges.weight(edge);
+        if ((weight <= delta) != light) continue;
+        requests[worker].push_back(
+            std::make_pair(edges.target(edge), current_distance + weight));
+      }
+    });
+  };
+  auto relax_requests = [&]() {
+    for (std::vector<Request>& worker_requests : requests) {
+      for (const auto& [i_neighbor, perspective_distance] : worker_requests) {
+        if (perspective_distance < distance_array[i_neighbor]) {
+          distance_array[i_neighbor] = perspective_distance;
+          buckets[perspective_distance / delta % bucket_count].push_back(
+              i_neighbor);
+          queued++;
+        }
+      }
+      worker_requests.clear();
+    }
+  };
+
+  unsigned round = 0;
+  std::vector<Alias::node_index> frontier;
+  std::vector<Alias::node_index> settled;
+  for (unsigned long long bucket = 0; queued > 0; ++bucket) {
+    std::vector<Alias::node_index>& current = buckets[bucket % bucket_count];
+    settled.clear();
+    while (!current.empty()) {
+      // Stale entries moved to a smaller distance or already taken this round
+      ++round;
+      frontier.clear();
+      for (Alias::node_index vertex : current) {
+        if (distance_array[vertex] / delta != bucket ||
+            round_stamps[vertex] == round)
+          continue;
+        round_stamps[vertex] = round;
+        frontier.push_back(vertex);
+        if (settled_stamps[vertex] != bucket + 1) {
+          settled_stamps[vertex] = bucket + 1;
+          settled.push_back(vertex);
+        }
+      }
+      queued -= current.size();
+      current.clear();
+      generate_requests(frontier, true);
+      relax_requests();
+    }
+    generate_requests(settled, false);
+    relax_requests();
+  }
+
+  result.distances = distance_array;
+  set_canonical_prev_nodes(graph, result);
+  return result;
+}
+
+RouteResult GraphAlgorithms::GetShortestRouteBetweenVertices(
+    const Graph& graph, const int vertex1, const int vertex2) {
   // minus 1 because of indexes values goes from 0
   const size_t size = graph.get_graph_size();
   if ((vertex1 <= 0 || static_cast<size_t>(vertex1) > size) ||
@@ -98,27 +484,164 @@ unsigned GraphAlgorithms::GetShortestPathBetweenVertices(const Graph& graph,
     throw std::invalid_argument("Invalid vertex value");
   int start = vertex1 - 1;
   int end = vertex2 - 1;
-  auto [distance_array, prev_node] = GetShortPath(graph, start);
-  return distance_array[end];
+
+  auto [distance_array, prev_node] = GetShortPath(graph, start, end);
+  RouteResult result{distance_array[end], {}};
+  if (result.distance != UINT_MAX) {
+    for (int at = end; at != -1; at = prev_node[at])
+      result.vertices.push_back(at + 1);
+    std::reverse(result.vertices.begin(), result.vertices.end());
+  }
+  return result;
+}
+
+unsigned GraphAlgorithms::GetShortestPathBetweenVertices(const Graph& graph,
+                                                         const int vertex1,
+                                                         const int vertex2) {
+  return GetShortestRouteBetweenVertices(graph, vertex1, vertex2).distance;
 }
 
 Alias::IntRow GraphAlgorithms::GetShortestVectorBetweenVertices(
     const Graph& graph, const int vertex1, const int vertex2) {
-  int start = vertex1 - 1;
-  int end = vertex2 - 1;
-
-  auto [distance_array, prev_node] = GetShortPath(graph, start);
-  Alias::IntRow short_path;
+  return GetShortestRouteBetweenVertices(graph, vertex1, vertex2).vertices;
+}
 
-  if (distance_array[end] != UINT_MAX) {
-    for (int at = end; at != -1; at = prev_node[at])
-      short_path.push_back(at + 1);
-    std::reverse(short_path.begin(), short_path.end());
+DistanceTable GraphAlgorithms::GetDistanceTable(const Graph& graph,
+                                                const Alias::IntRow& sources,
+                                                const Alias::IntRow& targets) {
+  const size_t size = graph.get_graph_size();
+  for (const Alias::IntRow* vertices : {&sources, &targets}) {
+    for (int vertex : *vertices) {
+      if (vertex <= 0 || static_cast<size_t>(vertex) > size)
+        throw std::invalid_argument("Invalid vertex value");
+    }
+  }
+  DistanceTable result{sources.size(), targets.size(), {}};
+  result.distances.assign(sources.size() * targets.size(), UINT_MAX);
+  if (result.distances.empty()) return result;
+
+  // Repeated targets are searched once
+  std::vector<bool> is_target(size, false);
+  size_t targets_left = 0;
+  for (int vertex : targets) {
+    if (!is_target[vertex - 1]) targets_left++;
+    is_target[vertex - 1] = true;
   }
-  return short_path;
+  const CsrGraph edges = CsrGraph::FromGraph(graph);
+  s21::thread_pool& pool = s21::thread_pool::shared();
+  std::vector<TableSearch> searches(pool.size());
+
+  pool.parallel_for(0, sources.size(), [&](size_t row, size_t worker) {
+    TableSearch& search = searches[worker];
+    if (search.distances.empty()) {
+      search.distances.assign(size, UINT_MAX);
+      search.stamps.assign(size, 0);
+      search.settled.assign(size, false);
+    }
+    if (++search.stamp == 0) {
+      search.stamps.assign(size, 0);
+      search.stamp = 1;
+    }
+    search.queue_nodes = {};
+    const Alias::node_index start = sources[row] - 1;
+    search.stamps[start] = search.stamp;
+    search.distances[start] = 0;
+    search.settled[start] = false;
+    search.queue_nodes.push(std::make_pair(0, start));
+    size_t left = targets_left;
+
+    while (!search.queue_nodes.empty() && left > 0) {
+      auto [current_distance, current_node] = search.queue_nodes.top();
+      search.queue_nodes.pop();
+      if (search.settled[current_node]) continue;
+      search.settled[current_node] = true;
+      if (is_target[current_node]) left--;
+      for (size_t edge = edges.begin(current_node);
+           edge < edges.end(current_node); ++edge) {
+        const Alias::node_index i_neighbor = edges.target(edge);
+        const Alias::distance perspective_distance =
+            current_distance + edges.weight(edge);
+        if (perspective_distance < search.distance_of(i_neighbor)) {
+          // First touch in this search resets the settled flag
+          search.stamps[i_neighbor] = search.stamp;
+          search.distances[i_neighbor] = perspective_distance;
+          search.settled[i_neighbor] = false;
+          search.queue_nodes.push(
+              std::make_pair(perspective_distance, i_neighbor));
+        }
+      }
+    }
+    for (size_t column = 0; column < targets.size(); ++column) {
+      const Alias::node_index target = targets[column] - 1;
+      if (search.stamps[target] == search.stamp && search.settled[target])
+        result.distances[row * targets.size() + column] =
+            search.distances[target];
+    }
+  });
+  return result;
 }
 
 Alias::IntGrid GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+    const Graph& graph, const ApspOptions& options) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  ApspStrategy strategy = options.strategy;
+  if (strategy == ApspStrategy::kAuto) strategy = pick_apsp_strategy(graph);
+  if (strategy == ApspStrategy::kDijkstra)
+    return GetShortestPathsDijkstra(graph, options);
+  return GetShortestPathsFloydBlocked(graph, options);
+}
+
+Alias::IntGrid GraphAlgorithms::GetShortestPathsFloydBlocked(
+    const Graph& graph, const ApspOptions& options) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+  with_thread_pool(options.threads, [&](s21::thread_pool& pool) {
+    FloydWarshall::Run(matrix, Tuning::floyd_warshall_tile, pool);
+  });
+  return matrix.ToGrid();
+}
+
+Alias::IntGrid GraphAlgorithms::GetShortestPathsDijkstra(
+    const Graph& graph, const ApspOptions& options) {
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  const DijkstraRows rows(graph);
+  if (rows.has_negative_cycle())
+    return GetShortestPathsFloydBlocked(graph, options);
+
+  Alias::IntGrid result{size};
+  with_thread_pool(options.threads, [&](s21::thread_pool& pool) {
+    std::vector<DijkstraRows::Search> searches(pool.size());
+    pool.parallel_for(0, size, [&](size_t start, size_t worker) {
+      rows.FillRow(start, searches[worker], result[start]);
+    });
+  });
+  return result;
+}
+
+ApspResult GraphAlgorithms::GetShortestPathsWithNextHops(
+    const Graph& graph, const ApspOptions& options) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+  NextHopMatrix next_hops;
+  with_thread_pool(options.threads, [&](s21::thread_pool& pool) {
+    next_hops = FloydWarshall::RunWithNextHops(
+        matrix, Tuning::floyd_warshall_tile, pool);
+  });
+  Alias::IntGrid distances = matrix.ToGrid();
+  // Hops of a vertex on a negative cycle go around it forever
+  for (size_t i = 0; i < distances.size(); ++i) {
+    if (distances[i][i] < 0)
+      throw std::invalid_argument("Graph has a negative cycle");
+  }
+  return {std::move(distances), std::move(next_hops)};
+}
+
+Alias::IntGrid GraphAlgorithms::GetShortestPathsFloydSimple(
     const Graph& graph) {
   // Get the number of vertices in the graph
   const size_t size = graph.get_graph_size();
@@ -170,7 +693,26 @@ Alias::IntGrid GraphAlgorithms::GetShortestPathsBetweenAllVertices(
   return result;
 }
 
-SpanTree GraphAlgorithms::GetSpanTree(const Graph& graph) {
+SpanTree GraphAlgorithms::GetSpanTree(const Graph& graph,
+                                      const MstStrategy strategy) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  if (strategy == MstStrategy::kKruskal) return GetSpanTreeKruskal(graph);
+  if (strategy == MstStrategy::kBoruvka) return GetSpanTreeBoruvka(graph);
+  SpanTree result;
+  // Directed graphs fall back to Prim's algorithm
+  if (strategy == MstStrategy::kAuto &&
+      pick_mst_strategy(graph) == MstStrategy::kKruskal &&
+      kruskal_span_tree(graph, s21::thread_pool::shared(), result))
+    return result;
+  if (is_dense_graph(graph)) return GetSpanTreeDense(graph);
+  const Alias::distance max_weight = max_edge_weight(graph);
+  return max_weight <= Tuning::bucket_queue_max_weight
+             ? GetSpanTreeBuckets(graph, max_weight)
+             : GetSpanTreeHeap(graph);
+}
+
+SpanTree GraphAlgorithms::GetSpanTreeHeap(const Graph& graph) {
   // Get the number of vertices in the graph
   const size_t size = graph.get_graph_size();
 
@@ -233,29 +775,219 @@ SpanTree GraphAlgorithms::GetSpanTree(const Graph& graph) {
     }
   }
 
-  // Convert the MST structure (prev_node array) to adjacency matrix format
-  Alias::IntGrid tree_matrix{size, std::vector<int>(size, 0)};
-  for (size_t i = 0; i < size; i++) {
-    int u = prev_node[i];
-    int v = i;
-    if (u != -1) {  // If there's a connection in the MST
-      tree_matrix[u][v] = graph[u][v];
-      tree_matrix[v][u] = graph[v][u];  // For undirected graph
+  // Return both the MST matrix and its total weight
+  return make_span_tree(graph, prev_node, mst_weight);
+}
+
+SpanTree GraphAlgorithms::GetSpanTreeDense(const Graph& graph) {
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+
+  // Same arrays as in GetShortPathDense, keys are edge weights here
+  std::vector<Alias::distance> keys(size, UINT_MAX);
+  std::vector<Alias::distance> settled(size, 0);
+  std::vector<int> prev_node(size, -1);
+  int mst_weight = 0;
+
+  keys[0] = 0;
+  for (size_t step = 0; step < size; ++step) {
+    const size_t current_node = Simd::argmin(keys.data(), size);
+    if (current_node == size) break;
+    mst_weight += keys[current_node];
+    keys[current_node] = UINT_MAX;
+    settled[current_node] = UINT_MAX;
+    // Base 0 - the key of a neighbor is the weight of the edge itself
+    Simd::relax_row(graph[current_node].data(), settled.data(), 0,
+                    static_cast<int>(current_node), keys.data(),
+                    prev_node.data(), size);
+  }
+  return make_span_tree(graph, prev_node, mst_weight);
+}
+
+SpanTree GraphAlgorithms::GetSpanTreeBuckets(const Graph& graph,
+                                             Alias::distance max_weight) {
+  const size_t size = graph.get_graph_size();
+  if (size == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+
+  // Same as GetSpanTreeHeap, keys are edge weights - never above the max one
+  std::vector<bool> visited(size, false);
+  std::vector<Alias::distance> distance_array(size, UINT_MAX);
+  std::vector<int> prev_node(size, -1);
+  if (max_weight == 0) max_weight = max_edge_weight(graph);
+  s21::bucket_queue<Alias::node_index> queue_nodes(max_weight);
+  int mst_weight = 0;
+
+  distance_array[0] = 0;
+  queue_nodes.push(0, 0);
+  while (!queue_nodes.empty()) {
+    const auto [current_dist, current_node] = queue_nodes.top();
+    queue_nodes.pop();
+    if (visited[current_node]) continue;
+    visited[current_node] = true;
+    mst_weight += current_dist;
+    const Alias::IntRow& row = graph[current_node];
+    for (Alias::node_index i_neighbor = 0; i_neighbor < size; ++i_neighbor) {
+      const Alias::distance weight = row[i_neighbor];
+      if (weight > 0 && !visited[i_neighbor] &&
+          weight < distance_array[i_neighbor]) {
+        distance_array[i_neighbor] = weight;
+        prev_node[i_neighbor] = current_node;
+        queue_nodes.push(weight, i_neighbor);
+      }
     }
   }
+  return make_span_tree(graph, prev_node, mst_weight);
+}
 
-  // Return both the MST matrix and its total weight
-  return {tree_matrix, mst_weight};
+SpanTree GraphAlgorithms::GetSpanTreeKruskal(const Graph& graph,
+                                             const size_t threads) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  SpanTree result;
+  bool undirected = false;
+  with_thread_pool(threads, [&](s21::thread_pool& pool) {
+    undirected = kruskal_span_tree(graph, pool, result);
+  });
+  if (!undirected) throw std::invalid_argument("Graph is not undirected");
+  return result;
+}
+
+SpanTree GraphAlgorithms::GetSpanTreeBoruvka(const Graph& graph,
+                                             const size_t threads,
+                                             MstStats* stats) {
+  if (graph.get_graph_size() == 0 || !graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  if (!for_each_undirected_edge(graph, [](size_t, size_t, int) {}))
+    throw std::invalid_argument("Graph is not undirected");
+  if (!is_dense_graph(graph))
+    return GetSpanTreeBoruvka(CsrGraph::FromGraph(graph), threads, stats);
+
+  SpanTree result;
+  with_thread_pool(threads, [&](s21::thread_pool& pool) {
+    result = boruvka_span_tree(
+        graph.get_graph_size(), pool,
+        [&](size_t v, const std::vector<uint32_t>& component) {
+          const Alias::IntRow& row = graph[v];
+          const uint32_t own = component[v];
+          // Branch free minimum of (weight, u) - the order of is_lighter
+          // with v fixed
+          uint64_t best = UINT64_MAX;
+          for (size_t u = 0; u < row.size(); ++u) {
+            const uint64_t key =
+                static_cast<uint64_t>(static_cast<uint32_t>(row[u])) << 32 |
+                u;
+            const bool edge = row[u] != 0 && component[u] != own;
+            best = std::min(best, edge ? key : UINT64_MAX);
+          }
+          if (best == UINT64_MAX) return SpanEdge{0, kNoEdge, kNoEdge};
+          return SpanEdge{static_cast<Alias::distance>(best >> 32),
+                          static_cast<uint32_t>(v),
+                          static_cast<uint32_t>(best)};
+        },
+        stats);
+  });
+  return result;
+}
+
+SpanTree GraphAlgorithms::GetSpanTreeBoruvka(const CsrGraph& graph,
+                                             const size_t threads,
+                                             MstStats* stats) {
+  if (graph.get_vertices_count() == 0)
+    throw std::invalid_argument("Invalid graph");
+  SpanTree result;
+  with_thread_pool(threads, [&](s21::thread_pool& pool) {
+    result = boruvka_span_tree(
+        graph.get_vertices_count(), pool,
+        [&](size_t v, const std::vector<uint32_t>& component) {
+          SpanEdge best{0, kNoEdge, kNoEdge};
+          const uint32_t own = component[v];
+          for (size_t e = graph.begin(v); e < graph.end(v); ++e) {
+            const Alias::node_index u = graph.target(e);
+            const Alias::distance weight = graph.weight(e);
+            // With v fixed is_lighter compares weights, then targets
+            if (component[u] != own &&
+                (best.from == kNoEdge || weight < best.weight ||
+                 (weight == best.weight && u < best.to)))
+              best = {weight, static_cast<uint32_t>(v),
+                      static_cast<uint32_t>(u)};
+          }
+          return best;
+        },
+        stats);
+  });
+  return result;
+}
+
+SpanTree SpanTree::FromEdges(const size_t size,
+                            const std::vector<TreeEdge>& edges) {
+  // Forest as adjacency arrays, then parents by a walk from vertex 0
+  std::vector<size_t> offsets(size + 1, 0);
+  for (const TreeEdge& edge : edges) {
+    ++offsets[edge.parent + 1];
+    ++offsets[edge.child + 1];
+  }
+  for (size_t v = 0; v < size; ++v) offsets[v + 1] += offsets[v];
+  std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+  std::vector<std::pair<int, int>> neighbors(2 * edges.size());
+  for (const TreeEdge& edge : edges) {
+    neighbors[fill[edge.parent]++] = {edge.child, edge.weight};
+    neighbors[fill[edge.child]++] = {edge.parent, edge.weight};
+  }
+  SpanTree result{Alias::IntRow(size, -1), {}, 0};
+  Alias::IntRow weights(size, 0);
+  std::vector<bool> reached(size, false);
+  std::vector<int> stack;
+  if (size > 0) {
+    stack.push_back(0);
+    reached[0] = true;
+  }
+  while (!stack.empty()) {
+    const int v = stack.back();
+    stack.pop_back();
+    for (size_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+      const auto [u, weight] = neighbors[i];
+      if (reached[u]) continue;
+      reached[u] = true;
+      result.parents[u] = v;
+      weights[u] = weight;
+      stack.push_back(u);
+    }
+  }
+  for (size_t v = 0; v < size; ++v) {
+    if (result.parents[v] == -1) continue;
+    result.edges.push_back({result.parents[v], static_cast<int>(v),
+                            weights[v]});
+    result.tree_weight += weights[v];
+  }
+  return result;
+}
+
+Alias::IntGrid SpanTree::ToMatrix() const {
+  const size_t size = parents.size();
+  Alias::IntGrid result{size, Alias::IntRow(size, 0)};
+  for (const TreeEdge& edge : edges) {
+    result[edge.parent][edge.child] = edge.weight;
+    result[edge.child][edge.parent] = edge.weight;
+  }
+  return result;
 }
 
 Alias::IntGrid GraphAlgorithms::GetLeastSpanningTree(const Graph& graph) {
-  auto [matrix, weight] = GetSpanTree(graph);
-  return matrix;
+  const SpanTree tree = GetSpanTree(graph);
+  const size_t size = graph.get_graph_size();
+  // Not ToMatrix - cells of a directed graph differ by direction
+  Alias::IntGrid result{size, Alias::IntRow(size, 0)};
+  for (const TreeEdge& edge : tree.edges) {
+    result[edge.parent][edge.child] = graph[edge.parent][edge.child];
+    result[edge.child][edge.parent] = graph[edge.child][edge.parent];
+  }
+  return result;
 }
 
 int GraphAlgorithms::GetSpanTreeWeight(const Graph& graph) {
-  auto [matrix, weight] = GetSpanTree(graph);
-  return weight;
+  return GetSpanTree(graph).tree_weight;
 }
 
 Ant::Ant(const Alias::node_index a_start_vertex = 0)
@@ -264,12 +996,19 @@ Ant::Ant(const Alias::node_index a_start_vertex = 0)
   ant_path_ = {};
 }
 
+void Ant::reset() {
+  current_vertex_ = start_vertex_;
+  ant_path_.vertices.clear();
+  ant_path_.distance = 0;
+  std::fill(visited_vertices_.begin(), visited_vertices_.end(), false);
+}
+
 bool Ant::is_vertex_visited(const Alias::node_index a_vertex) const {
-  return visited_vertices_.find(a_vertex) != visited_vertices_.end();
+  return a_vertex < visited_vertices_.size() && visited_vertices_[a_vertex];
 }
 
 bool Ant::is_vertex_unvisited(const Alias::node_index a_vertex) const {
-  return visited_vertices_.count(a_vertex) == 0;
+  return !is_vertex_visited(a_vertex);
 }
 
 void Ant::visit_vertex(const Graph& a_graph, const Alias::node_index a_vertex) {
@@ -279,23 +1018,24 @@ void Ant::visit_vertex(const Graph& a_graph, const Alias::node_index a_vertex) {
   }
   current_vertex_ = a_vertex;
   ant_path_.vertices.push_back(a_vertex);
-  visited_vertices_.insert(a_vertex);
+  if (visited_vertices_.size() < a_graph.get_graph_size())
+    visited_vertices_.resize(a_graph.get_graph_size(), false);
+  visited_vertices_[a_vertex] = true;
 }
 
-double AntHill::random_destination() const {
-  std::random_device seed;
-  std::mt19937 gen(seed());
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
-  double result = dist(gen);
-  return result;
+double AntHill::random_destination(Ant& a_ant) const {
+  return a_ant.random_.uniform();
 }
 
 void AntHill::set_alpha_pheromone_weight(const double a_value) {
   alpha_pheromone_weight_ = a_value;
+  update_choice_weights();
 }
 
 void AntHill::set_beta_distance_weight_(const double a_value) {
   beta_distance_weight_ = a_value;
+  prepare_heuristic();
+  update_choice_weights();
 }
 
 void AntHill::set_q_regulation_parameter_(const double a_value) {
@@ -333,8 +1073,86 @@ bool GraphAlgorithms::is_graph_connected(const Graph& graph) {
   return std::all_of(visited.begin(), visited.end(), [](bool v) { return v; });
 };
 
+double GraphAlgorithms::edge_density(const Graph& graph) {
+  const size_t size = graph.get_graph_size();
+  if (size < 2) return 0.0;
+  DensityCache& cache = density_cache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.revision == graph.get_revision()) return cache.density;
+  }
+  size_t edges = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const Alias::IntRow& row = graph[i];
+    for (size_t j = 0; j < size; ++j) edges += (row[j] != 0);
+    edges -= (row[i] != 0);  // loops are not edges
+  }
+  const double density = static_cast<double>(edges) / (size * (size - 1));
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.revision = graph.get_revision();
+  cache.density = density;
+  return density;
+}
+
+ApspStrategy GraphAlgorithms::pick_apsp_strategy(const Graph& graph) {
+  const double size = graph.get_graph_size();
+  const double edges = edge_density(graph) * size * (size - 1);
+  const double dijkstra = Tuning::apsp_dijkstra_edge_cost * size *
+                          (edges + size) * std::log2(size + 1);
+  return dijkstra < size * size * size ? ApspStrategy::kDijkstra
+                                       : ApspStrategy::kFloydWarshall;
+}
+
+MstStrategy GraphAlgorithms::pick_mst_strategy(const Graph& graph) {
+  return edge_density(graph) < Tuning::kruskal_max_density
+             ? MstStrategy::kKruskal
+             : MstStrategy::kPrim;
+}
+
+bool GraphAlgorithms::is_dense_graph(const Graph& graph) {
+  return edge_density(graph) >= Tuning::dense_graph_density;
+}
+
+Alias::distance GraphAlgorithms::max_edge_weight(const Graph& graph) {
+  const size_t size = graph.get_graph_size();
+  Alias::distance result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const Alias::IntRow& row = graph[i];
+    for (size_t j = 0; j < size; ++j) {
+      if (i != j)
+        result = std::max(result, static_cast<Alias::distance>(row[j]));
+    }
+  }
+  return result;
+}
+
+void GraphAlgorithms::set_canonical_prev_nodes(const Graph& graph,
+                                               ShortPath& path) {
+  const size_t size = graph.get_graph_size();
+  const CsrGraph incoming = CsrGraph::Transposed(graph);
+  const std::vector<Alias::distance>& distance_array = path.distances;
+  path.prev_nodes.assign(size, -1);
+  s21::thread_pool::shared().parallel_for(0, size, [&](size_t v, size_t) {
+    if (distance_array[v] == UINT_MAX) return;
+    int best = -1;
+    for (size_t edge = incoming.begin(v); edge < incoming.end(v); ++edge) {
+      const Alias::node_index u = incoming.target(edge);
+      if (distance_array[u] == UINT_MAX ||
+          distance_array[u] + incoming.weight(edge) != distance_array[v] ||
+          distance_array[u] >= distance_array[v])
+        continue;
+      // Heap pops (distance, index) pairs - the smallest pair settles first
+      if (best == -1 || distance_array[u] < distance_array[best])
+        best = static_cast<int>(u);
+    }
+    path.prev_nodes[v] = best;
+  });
+}
+
 AntHill::AntHill(const Graph& a_graph) : graph_{a_graph} {
   anthill_size_ = graph_.get_graph_size();
+  std::random_device seed;
+  seed_ = (uint64_t{seed()} << 32) | seed();
   pheromone_matrix_ = Alias::PheromoneGrid(
       anthill_size_, std::vector<double>(anthill_size_, start_pheromone_));
   for (size_t i = 0; i < anthill_size_; i++) {
@@ -344,144 +1162,151 @@ AntHill::AntHill(const Graph& a_graph) : graph_{a_graph} {
       }
     }
   }
+  prepare_heuristic();
+  update_choice_weights();
 }
 
 void AntHill::prepare_ants() {
   ant_squad_.resize(anthill_size_);
+  s21::xoshiro256pp stream(seed_);
   for (size_t i = 0; i < anthill_size_; i++) {
     ant_squad_[i] = Ant(i);
+    ant_squad_[i].random_ = stream;
+    stream.jump();
+    ant_squad_[i].candidates_.reserve(anthill_size_);
+    ant_squad_[i].cumulative_weights_.reserve(anthill_size_);
   }
 }
 
-std::vector<Alias::node_index> Ant::get_available_neighbors(
-    const Graph& a_graph) const {
-  const size_t size = a_graph.get_graph_size();
-  std::vector<size_t> result;
-  for (size_t i_neigh = 0; i_neigh < size; i_neigh++) {
-    bool is_neighbor_exists =
-        (a_graph[current_vertex_][i_neigh] != 0) ? true : false;
-    bool is_neighbor_strange = is_vertex_unvisited(i_neigh);
-    if (is_neighbor_exists && is_neighbor_strange) result.push_back(i_neigh);
+void AntHill::prepare_heuristic() {
+  heuristic_.assign(anthill_size_ * anthill_size_, 0.0);
+  for (size_t i = 0; i < anthill_size_; i++) {
+    for (size_t j = 0; j < anthill_size_; j++) {
+      double weight = graph_[i][j];
+      if (weight > 0)
+        heuristic_[i * anthill_size_ + j] =
+            pow(1.0 / weight, beta_distance_weight_);
+    }
   }
-  return result;
-}
-
-double AntHill::greepy_part(const Ant& a_ant,
-                            const Alias::node_index a_neighbor) const {
-  double weight = graph_[a_ant.get_current_vertex()][a_neighbor];
-  if (weight <= 0) return 0.0;
-  return pow(1.0 / weight, beta_distance_weight_);
 }
 
-double AntHill::herd_part(const Ant& a_ant,
-                          const Alias::node_index a_neighbor) const {
-  return pow(pheromone_matrix_[a_ant.get_current_vertex()][a_neighbor],
-             alpha_pheromone_weight_);
+void AntHill::update_choice_weights() {
+  choice_weights_.resize(heuristic_.size());
+  // pow is the costly part, the default alpha needs none
+  const bool linear = alpha_pheromone_weight_ == 1.0;
+  for (size_t i = 0; i < anthill_size_; i++) {
+    const double* heuristic = heuristic_.data() + i * anthill_size_;
+    double* weights = choice_weights_.data() + i * anthill_size_;
+    for (size_t j = 0; j < anthill_size_; j++) {
+      const double pheromone = pheromone_matrix_[i][j];
+      if (heuristic[j] == 0.0)
+        weights[j] = 0.0;
+      else if (linear)
+        weights[j] = heuristic[j] * pheromone;
+      else
+        weights[j] = heuristic[j] * pow(pheromone, alpha_pheromone_weight_);
+    }
+  }
 }
 
 double AntHill::ant_desire_to_neighbor(
     const Ant& a_ant, const Alias::node_index a_neighbor) const {
-  double greedy = greepy_part(a_ant, a_neighbor);
-  double herd = herd_part(a_ant, a_neighbor);
-  return greedy * herd;
+  return choice_weights_[a_ant.get_current_vertex() * anthill_size_ +
+                         a_neighbor];
 }
 
 double Ant::pheromone_to_add(const double a_parameter) const {
   return ant_path_.vertices.empty() ? 0.0 : a_parameter / ant_path_.distance;
 }
 
-void AntHill::update_pheromone(const Ant& a_ant) {
-  for (size_t i = 0; i < anthill_size_; i++) {
-    for (size_t j = 0; j < anthill_size_; j++) {
-      pheromone_matrix_[i][j] *= (1 - p_pheromone_evaporation_coef_);
+void AntHill::update_pheromone(const std::vector<Ant>& a_ants,
+                               s21::thread_pool& a_pool) {
+  const double remains = 1 - p_pheromone_evaporation_coef_;
+  const double evaporation = pow(remains, a_ants.size());
+  a_pool.parallel_for(0, anthill_size_, [&](size_t i, size_t) {
+    for (double& pheromone : pheromone_matrix_[i]) pheromone *= evaporation;
+  });
+  // The last ant's deposit does not evaporate, every earlier one once more
+  double scale = 1.0;
+  for (size_t ant = a_ants.size(); ant-- > 0;) {
+    const auto& ant_path_edges = a_ants[ant].get_ant_path_result().vertices;
+    const double delta_pheromone =
+        scale * a_ants[ant].pheromone_to_add(q_regulation_parameter_);
+    for (size_t i = 1; i < ant_path_edges.size(); i++) {
+      size_t from = ant_path_edges[i - 1];
+      size_t to = ant_path_edges[i];
+      pheromone_matrix_[from][to] += delta_pheromone;
     }
-  }
-  const auto& ant_path_edges = a_ant.get_ant_path_result().vertices;
-  const double delta_pheromone =
-      a_ant.pheromone_to_add(q_regulation_parameter_);
-
-  for (size_t i = 1; i < ant_path_edges.size(); i++) {
-    size_t from = ant_path_edges[i - 1];
-    size_t to = ant_path_edges[i];
-    pheromone_matrix_[from][to] += delta_pheromone;
+    scale *= remains;
   }
 }
 
-double AntHill::ant_transition_probability(
-    const Ant& a_ant, const Alias::node_index a_neighbor) const {
-  std::vector<Alias::node_index> ant_good_neighbors =
-      a_ant.get_available_neighbors(graph_);
-  double ant_desire_to_j = ant_desire_to_neighbor(a_ant, a_neighbor);
-  double ant_summary_desire{0};
-  for (const auto& vertex : ant_good_neighbors) {
-    ant_summary_desire += ant_desire_to_neighbor(a_ant, vertex);
+size_t AntHill::choose_next_vertex(Ant& a_ant) const {
+  const size_t current = a_ant.get_current_vertex();
+  const Alias::IntRow& edges = graph_[current];
+  const double* weights = choice_weights_.data() + current * anthill_size_;
+  std::vector<size_t>& candidates = a_ant.candidates_;
+  std::vector<double>& cumulative = a_ant.cumulative_weights_;
+  candidates.clear();
+  cumulative.clear();
+  double sum = 0.0;
+  for (size_t i_neigh = 0; i_neigh < anthill_size_; i_neigh++) {
+    if (edges[i_neigh] == 0 || a_ant.is_vertex_visited(i_neigh)) continue;
+    sum += weights[i_neigh];
+    candidates.push_back(i_neigh);
+    cumulative.push_back(sum);
   }
-  return ant_desire_to_j / ant_summary_desire;
+  if (candidates.empty()) return current;
+  // random <= sum of probabilities up to i is random * sum <= cumulative[i]
+  const double target = random_destination(a_ant) * sum;
+  auto chosen = std::lower_bound(cumulative.begin(), cumulative.end(), target);
+  if (chosen == cumulative.end()) return candidates.back();
+  return candidates[chosen - cumulative.begin()];
 }
 
-size_t AntHill::choose_next_vertex(const Ant& a_ant) const {
-  std::vector<size_t> available_neighbors =
-      a_ant.get_available_neighbors(graph_);
-  if (available_neighbors.empty()) {
-    return a_ant.get_current_vertex();
-  }
-  std::vector<double> probabilities;
-  double sum_prob = 0.0;
-  for (const auto& neighbor : available_neighbors) {
-    double prob = ant_transition_probability(a_ant, neighbor);
-    probabilities.push_back(prob);
-    sum_prob += prob;
-  }
-  double random = random_destination();
-  double summary_probability{0.0};
-  for (size_t i = 0; i < available_neighbors.size(); i++) {
-    summary_probability += probabilities[i];
-    if (random <= summary_probability) return available_neighbors[i];
+void AntHill::build_tour(Ant& a_ant) const {
+  while (true) {
+    size_t next_vertex = choose_next_vertex(a_ant);
+    if (next_vertex == a_ant.get_current_vertex() ||
+        a_ant.is_vertex_visited(next_vertex)) {
+      break;
+    }
+    a_ant.visit_vertex(graph_, next_vertex);
+    // Close cycle if goes all vertices
+    if (a_ant.get_ant_path_result().vertices.size() == anthill_size_) {
+      size_t start = a_ant.get_ant_path_result().vertices.front();
+      a_ant.visit_vertex(graph_, start);  // close cycle
+    }
   }
-  return available_neighbors.back();
 }
 
 void AntHill::run_ant_colony() {
   prepare_ants();
-  for (size_t iteration = 0; iteration < anthill_size_; ++iteration) {
-    // All ants build paths
-    for (Ant& ant : ant_squad_) {
-      while (true) {
-        size_t next_vertex = choose_next_vertex(ant);
-        if (next_vertex == ant.get_current_vertex() ||
-            ant.is_vertex_visited(next_vertex)) {
-          break;
-        }
-        ant.visit_vertex(graph_, next_vertex);
-        // Close cycle if goes all vertices
-        if (ant.get_ant_path_result().vertices.size() == anthill_size_) {
-          size_t start = ant.get_ant_path_result().vertices.front();
-          ant.visit_vertex(graph_, start);  // close cycle
-        }
+  best_tour_ = {};
+  with_thread_pool(threads_, [&](s21::thread_pool& pool) {
+    for (size_t iteration = 0; iteration < anthill_size_; ++iteration) {
+      // All ants build new paths, each with its own stream and buffers
+      pool.parallel_for(0, ant_squad_.size(), [&](size_t ant, size_t) {
+        ant_squad_[ant].reset();
+        build_tour(ant_squad_[ant]);
+      });
+      // Paths are rebuilt by the next iteration, the best one is kept
+      for (const Ant& ant : ant_squad_) {
+        const TsmResult& res = ant.ant_path_;
+        if (res.vertices.size() == anthill_size_ + 1 &&
+            (best_tour_.vertices.empty() || res.distance < best_tour_.distance))
+          best_tour_ = res;
       }
+      // update pheromone on all routes
+      update_pheromone(ant_squad_, pool);
+      update_choice_weights();
     }
-    // update pheromone on all routes
-    for (Ant& ant : ant_squad_) {
-      update_pheromone(ant);
-    }
-  }
+  });
 }
 
 TsmResult AntHill::solve_salesman_graph() {
   run_ant_colony();
-  TsmResult best_result;
-  bool found = false;
-
-  for (const auto& ant : ant_squad_) {
-    const auto& res = ant.get_ant_path_result();
-    if (res.vertices.size() == anthill_size_ + 1) {
-      if (!found || res.distance < best_result.distance) {
-        best_result = res;
-        found = true;
-      }
-    }
-  }
-  return best_result;
+  return best_tour_;
 }
 
 TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(const Graph& graph) {
@@ -10,20 +10,59 @@
  * - Shortest path algorithms (Dijkstra, Floyd-Warshall)
  * - Minimum spanning tree algorithms
  * - Ant Colony Optimization for Traveling Salesman Problem
+ * - Point-to-point engines (bidirectional Dijkstra, ALT landmarks,
+ *   Contraction Hierarchies)
  */
 
 #ifndef S21_GRAPH_ALGORITHMS_H
 #define S21_GRAPH_ALGORITHMS_H
 
 #include <algorithm>
+#include <cmath>
 #include <queue>
 #include <random>
+#include <tuple>
 #include <unordered_set>
 
+#include "../s21_bucket_queue/s21_bucket_queue.h"
+#include "../s21_disjoint_set/s21_concurrent_disjoint_set.h"
+#include "../s21_disjoint_set/s21_disjoint_set.h"
 #include "../s21_graph/s21_graph.h"
 #include "../s21_linked_list/s21_linked_list.h"
 #include "../s21_queue/s21_queue.h"
+#include "../s21_radix_heap/s21_radix_heap.h"
+#include "../s21_radix_sort/s21_radix_sort.h"
+#include "../s21_random/s21_xoshiro.h"
 #include "../s21_stack/s21_stack.h"
+#include "../s21_thread_pool/s21_thread_pool.h"
+#include "s21_dijkstra_rows.h"
+#include "s21_floyd_warshall.h"
+#include "s21_simd_kernels.h"
+
+/**
+ * @namespace Tuning
+ * @brief Thresholds used to pick an implementation of an algorithm
+ */
+namespace Tuning {
+/// Edge density from which array-scan Dijkstra and Prim replace heap versions
+inline constexpr double dense_graph_density = 0.1;
+/// Max edge weight up to which Prim's algorithm uses Dial's bucket queue
+inline constexpr Alias::distance bucket_queue_max_weight = 1024;
+/// Default memory limit of ShortPathCache in bytes
+inline constexpr size_t short_path_cache_bytes = 64 * 1024 * 1024;
+/// Settled vertices after which a contraction witness search gives up
+inline constexpr size_t witness_settle_limit = 500;
+/// Cost of a Dijkstra edge relaxation in vectorized Floyd-Warshall updates
+inline constexpr double apsp_dijkstra_edge_cost = 30.0;
+/// Tile size of blocked Floyd-Warshall, three int tiles take 768 KB of L2
+inline constexpr size_t floyd_warshall_tile = 256;
+/// Default memory limit of LazyDistanceMatrix in bytes
+inline constexpr size_t lazy_distance_matrix_bytes = 64 * 1024 * 1024;
+/// Edge density below which Kruskal's algorithm replaces Prim's
+inline constexpr double kruskal_max_density = 0.15;
+/// Default disk limit of ResultCache in bytes
+inline constexpr size_t result_cache_bytes = 256 * 1024 * 1024;
+}  // namespace Tuning
 
 /**
  * @brief Generic graph traversal function
@@ -46,12 +85,120 @@ struct ShortPath {
   std::vector<int> prev_nodes;  ///< Previous node in shortest path
 };
 
+/**
+ * @brief Structure representing shortest path between two vertices
+ */
+struct RouteResult {
+  Alias::distance distance;  ///< Path distance, UINT_MAX if there is no path
+  Alias::IntRow vertices;    ///< Sequence of vertices (numeration from 1)
+};
+
+/**
+ * @brief Structure representing distances from sources to targets
+ */
+struct DistanceTable {
+  size_t sources_count;  ///< Number of rows
+  size_t targets_count;  ///< Number of columns
+  std::vector<Alias::distance>
+      distances;  ///< Row-major table, UINT_MAX if there is no path
+
+  /**
+   * @brief Gets distance from source to target
+   * @param[in] a_source Row - index in requested sources
+   * @param[in] a_target Column - index in requested targets
+   * @return Distance
+   */
+  Alias::distance at(const size_t a_source, const size_t a_target) const {
+    return distances[a_source * targets_count + a_target];
+  }
+};
+
+/**
+ * @brief Structure representing all pairs shortest paths with their routes
+ */
+struct ApspResult {
+  Alias::IntGrid distances;  ///< Like GetShortestPathsBetweenAllVertices
+  NextHopMatrix next_hops;   ///< Routes, see NextHopMatrix::GetPath
+};
+
+/**
+ * @enum ApspStrategy
+ * @brief Algorithm of all pairs shortest paths
+ */
+enum class ApspStrategy {
+  kAuto,           ///< Picked by GraphAlgorithms::pick_apsp_strategy
+  kFloydWarshall,  ///< GraphAlgorithms::GetShortestPathsFloydBlocked
+  kDijkstra        ///< GraphAlgorithms::GetShortestPathsDijkstra
+};
+
+/**
+ * @brief Structure representing settings of all pairs shortest paths
+ */
+struct ApspOptions {
+  size_t threads = 0;  ///< Worker threads, 0 - s21::thread_pool::shared()
+  ApspStrategy strategy = ApspStrategy::kAuto;  ///< Algorithm
+};
+
+/**
+ * @brief Edge of a spanning tree
+ */
+struct TreeEdge {
+  int parent;  ///< Vertex index on the side of vertex 0
+  int child;   ///< Vertex index on the other side
+  int weight;  ///< Edge weight
+
+  /**
+   * @brief Compares two edges
+   * @return true if all fields are equal
+   */
+  bool operator==(const TreeEdge&) const = default;
+};
+
 /**
  * @brief Structure representing spanning tree information
+ * @details The tree is rooted at vertex 0 and takes O(V) memory, the
+ * adjacency matrix is built only by ToMatrix
  */
 struct SpanTree {
-  Alias::IntGrid Tree;  ///< Adjacency matrix of spanning tree
-  int tree_weight;      ///< Total weight of spanning tree
+  /// Parent of every vertex, -1 for vertex 0 and vertices out of the tree
+  Alias::IntRow parents;
+  std::vector<TreeEdge> edges;  ///< Edge to every parent, ordered by child
+  int tree_weight = 0;          ///< Total weight of spanning tree
+
+  /**
+   * @brief Roots forest at vertex 0
+   * @param[in] size Number of vertices
+   * @param[in] edges Forest edges in any direction and order
+   * @details Edges out of the tree of vertex 0 are dropped
+   * @return Spanning tree of the tree of vertex 0
+   */
+  static SpanTree FromEdges(const size_t size,
+                            const std::vector<TreeEdge>& edges);
+
+  /**
+   * @brief Builds adjacency matrix of the tree
+   * @return Symmetric V x V matrix with edge weights, O(V^2) memory
+   */
+  Alias::IntGrid ToMatrix() const;
+};
+
+/**
+ * @enum MstStrategy
+ * @brief Algorithm of minimum spanning tree
+ */
+enum class MstStrategy {
+  kAuto,     ///< Picked by GraphAlgorithms::pick_mst_strategy
+  kPrim,     ///< Prim's algorithm, variant picked by density and weights
+  kKruskal,  ///< GraphAlgorithms::GetSpanTreeKruskal
+  kBoruvka   ///< GraphAlgorithms::GetSpanTreeBoruvka
+};
+
+/**
+ * @brief Structure representing work of a spanning tree algorithm
+ */
+struct MstStats {
+  size_t rounds = 0;      ///< Rounds of merging components
+  size_t tree_edges = 0;  ///< Edges of the spanning forest
 };
 
 /**
@@ -90,9 +237,90 @@ class GraphAlgorithms {
    * @brief Gets shortest paths from source vertex (Dijkstra's algorithm)
    * @param[in] graph Input graph
    * @param[in] start_index Source vertex index
+   * @param[in] stop_index Index to stop at when it is settled, -1 - never
+   * @details Picks GetShortPathDense on dense graphs, GetShortPathHeap on
+   * sparse ones. Density is measured once per graph revision, so early
+   * stopped queries on an unchanged graph do not scan the matrix. After an
+   * early stop only stop_index and the nodes of its path are final
    * @return ShortPath structure with distances and previous nodes
    */
-  static ShortPath GetShortPath(const Graph& graph, const int start_index);
+  static ShortPath GetShortPath(const Graph& graph, const int start_index,
+                                const int stop_index = -1);
+
+  /**
+   * @brief Heap based Dijkstra's algorithm - O((V + E) log V) + row scans
+   * @param[in] graph Input graph
+   * @param[in] start_index Source vertex index
+   * @param[in] stop_index Index to stop at when it is settled, -1 - never
+   * @return ShortPath structure with distances and previous nodes
+   */
+  static ShortPath GetShortPathHeap(const Graph& graph, const int start_index,
+                                    const int stop_index = -1);
+
+  /**
+   * @brief Array-scan Dijkstra's algorithm - O(V^2) with vector kernels
+   * @param[in] graph Input graph
+   * @param[in] start_index Source vertex index
+   * @param[in] stop_index Index to stop at when it is settled, -1 - never
+   * @details Min-selection and row relaxation go through Simd kernels. The
+   * result is identical to GetShortPathHeap, ties included.
+   * @return ShortPath structure with distances and previous nodes
+   */
+  static ShortPath GetShortPathDense(const Graph& graph, const int start_index,
+                                     const int stop_index = -1);
+
+  /**
+   * @brief Dijkstra's algorithm on Dial's bucket queue - O(V^2 + V * C)
+   * @param[in] graph Input graph
+   * @param[in] start_index Source vertex index
+   * @param[in] max_weight Max edge weight of graph, 0 - scan graph for it
+   * @details Queue has a bucket per weight, so C (max weight) must be small.
+   * The result is identical to GetShortPathHeap
+   * @return ShortPath structure with distances and previous nodes
+   */
+  static ShortPath GetShortPathBuckets(const Graph& graph,
+                                       const int start_index,
+                                       Alias::distance max_weight = 0);
+
+  /**
+   * @brief Dijkstra's algorithm on radix heap - O(V^2 + E log C)
+   * @param[in] graph Input graph
+   * @param[in] start_index Source vertex index
+   * @details The result is identical to GetShortPathHeap
+   * @return ShortPath structure with distances and previous nodes
+   */
+  static ShortPath GetShortPathRadixHeap(const Graph& graph,
+                                         const int start_index);
+
+  /**
+   * @brief Parallel Delta-stepping single-source shortest paths
+   * @param[in] graph Input graph
+   * @param[in] start_index Source vertex index
+   * @param[in] delta Bucket width, 0 - max edge weight / average out-degree
+   * @details Buckets hold vertices by distance / delta. Light edges (weight
+   * up to delta) of a bucket are relaxed until it stays empty, heavy edges
+   * once when it is done. Relaxation requests are generated over
+   * s21::thread_pool::shared() and applied in worker order. The result is
+   * identical to GetShortPath, previous nodes included
+   * @return ShortPath structure with distances and previous nodes
+   */
+  static ShortPath GetShortPathDeltaStepping(const Graph& graph,
+                                             const int start_index,
+                                             const Alias::distance delta = 0);
+
+  /**
+   * @brief Gets shortest path distance and vertices between two vertices
+   * @param[in] graph Input graph
+   * @param[in] vertex1 Source vertex
+   * @param[in] vertex2 Target vertex
+   * @details Single Dijkstra run which stops as soon as vertex2 is settled
+   * @return RouteResult with distance (UINT_MAX and no vertices if there is
+   * no path) and sequence of vertices
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  static RouteResult GetShortestRouteBetweenVertices(const Graph& graph,
+                                                     const int vertex1,
+                                                     const int vertex2);
 
   /**
    * @brief Gets shortest path distance between two vertices
@@ -116,27 +344,178 @@ class GraphAlgorithms {
                                                         const int vertex1,
                                                         const int vertex2);
 
+  /**
+   * @brief Gets distances from every source to every target
+   * @param[in] graph Input graph
+   * @param[in] sources Source vertices (numeration from 1)
+   * @param[in] targets Target vertices (numeration from 1)
+   * @details One search per source, stopped once every target is settled.
+   * Sources are spread over s21::thread_pool::shared(), every worker reuses
+   * its search buffers
+   * @return DistanceTable of sources x targets
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  static DistanceTable GetDistanceTable(const Graph& graph,
+                                        const Alias::IntRow& sources,
+                                        const Alias::IntRow& targets);
+
   /**
    * @brief Gets all pairs shortest paths (Floyd-Warshall algorithm)
    * @param[in] graph Input graph
    * @details This function implements the Floyd-Warshall algorithm to find
-   * shortest paths between all pairs of vertices in a graph
-   * @return Distance matrix between all pairs of vertices
+   * shortest paths between all pairs of vertices in a graph. Runs
+   * GetShortestPathsFloydBlocked or GetShortestPathsDijkstra by
+   * options.strategy
+   * @param[in] options Thread count and algorithm, the result does not depend
+   * on them
+   * @return Distance matrix between all pairs of vertices, 0 if there is no
+   * path
+   * @throws std::invalid_argument if the graph is empty or invalid
+   */
+  static Alias::IntGrid GetShortestPathsBetweenAllVertices(
+      const Graph& graph, const ApspOptions& options = ApspOptions());
+
+  /**
+   * @brief Gets all pairs shortest paths with one Dijkstra run per source
+   * @param[in] graph Input graph
+   * @param[in] options Thread count
+   * @details Sources are spread over options.threads workers, every worker
+   * reuses its search buffers. Negative weights are handled like in Johnson's
+   * algorithm: Bellman-Ford potentials make every edge non-negative for the
+   * searches and are taken back from the distances. A negative cycle falls
+   * back to GetShortestPathsFloydBlocked. The result is identical to
+   * GetShortestPathsFloydSimple
+   * @return Distance matrix like GetShortestPathsBetweenAllVertices
+   * @throws std::invalid_argument if the graph is empty or invalid
+   */
+  static Alias::IntGrid GetShortestPathsDijkstra(
+      const Graph& graph, const ApspOptions& options = ApspOptions());
+
+  /**
+   * @brief Gets all pairs shortest paths and a next hop for every pair
+   * @param[in] graph Input graph
+   * @param[in] options Thread count, the result does not depend on it
+   * @details Blocked Floyd-Warshall updating hops next to distances
+   * (FloydWarshall::RunWithNextHops). Routes are read from the hops with
+   * NextHopMatrix::GetPath without any further search
+   * @return Distances like GetShortestPathsBetweenAllVertices and next hops
+   * @throws std::invalid_argument if the graph is empty, invalid or has a
+   * negative cycle
+   */
+  static ApspResult GetShortestPathsWithNextHops(
+      const Graph& graph, const ApspOptions& options = ApspOptions());
+
+  /**
+   * @brief Gets all pairs shortest paths with the textbook triple loop
+   * @param[in] graph Input graph
+   * @details Streams the whole matrix for every intermediate vertex
+   * @return Distance matrix like GetShortestPathsBetweenAllVertices
+   * @throws std::invalid_argument if the graph is empty or invalid
+   */
+  static Alias::IntGrid GetShortestPathsFloydSimple(const Graph& graph);
+
+  /**
+   * @brief Gets all pairs shortest paths with cache blocked Floyd-Warshall
+   * @param[in] graph Input graph
+   * @details Runs FloydWarshall::Run on a contiguous DistanceMatrix with
+   * Tuning::floyd_warshall_tile tiles. Independent tiles of every round run
+   * in parallel on options.threads workers. The result is identical to
+   * GetShortestPathsFloydSimple
+   * @param[in] options Thread count
+   * @return Distance matrix like GetShortestPathsBetweenAllVertices
+   * @throws std::invalid_argument if the graph is empty or invalid
    */
-  static Alias::IntGrid GetShortestPathsBetweenAllVertices(const Graph& graph);
+  static Alias::IntGrid GetShortestPathsFloydBlocked(
+      const Graph& graph, const ApspOptions& options = ApspOptions());
 
   /**
    * @brief Gets spanning tree information
    * @param[in] graph Input graph
+   * @param[in] strategy Algorithm, kAuto - by pick_mst_strategy
    * @details // This function implements Prim's algorithm to find a Minimum
-   * Spanning Tree (MST)
+   * Spanning Tree (MST). Picks GetSpanTreeDense by edge density, then
+   * GetSpanTreeBuckets for small weights and GetSpanTreeHeap for the rest.
+   * Sparse undirected graphs go to GetSpanTreeKruskal
+   * @return SpanTree structure with tree and weight
+   */
+  static SpanTree GetSpanTree(const Graph& graph,
+                              const MstStrategy strategy = MstStrategy::kAuto);
+
+  /**
+   * @brief Heap based Prim's algorithm
+   * @param[in] graph Input graph
+   * @return SpanTree structure with tree and weight
+   */
+  static SpanTree GetSpanTreeHeap(const Graph& graph);
+
+  /**
+   * @brief Array-scan Prim's algorithm - O(V^2) with vector kernels
+   * @param[in] graph Input graph
+   * @details The result is identical to GetSpanTreeHeap, ties included
    * @return SpanTree structure with tree and weight
    */
-  static SpanTree GetSpanTree(const Graph& graph);
+  static SpanTree GetSpanTreeDense(const Graph& graph);
+
+  /**
+   * @brief Prim's algorithm on Dial's bucket queue - O(V^2 + V * C)
+   * @param[in] graph Input graph
+   * @param[in] max_weight Max edge weight of graph, 0 - scan graph for it
+   * @details Weight is the same as of GetSpanTreeHeap, but one of several
+   * equally light edges may be picked instead of another
+   * @return SpanTree structure with tree matrix and its weight
+   */
+  static SpanTree GetSpanTreeBuckets(const Graph& graph,
+                                     Alias::distance max_weight = 0);
+
+  /**
+   * @brief Kruskal's algorithm - O(V^2 + E * alpha(V))
+   * @param[in] graph Input graph
+   * @param[in] threads Sorting workers, 0 - s21::thread_pool::shared()
+   * @details Reads the edge list from the matrix once, sorts it by weight
+   * with s21::radix_sort and joins trees with s21::disjoint_set. Spans the
+   * component of vertex 0 like Prim's algorithm, the weight is the same
+   * @return SpanTree structure with tree matrix and its weight
+   * @throws std::invalid_argument if graph is invalid or not undirected
+   */
+  static SpanTree GetSpanTreeKruskal(const Graph& graph,
+                                     const size_t threads = 0);
+
+  /**
+   * @brief Parallel Boruvka's algorithm - O((V^2 or E) * log(V) / threads)
+   * @param[in] graph Input graph
+   * @param[in] threads Worker threads, 0 - s21::thread_pool::shared()
+   * @param[out] stats Rounds and forest size, may be nullptr
+   * @details Every round all vertices look for their lightest edge to
+   * another component at once, the lightest of every component is then
+   * joined with s21::concurrent_disjoint_set. Ties are broken by vertex
+   * indexes, so the tree does not depend on the thread count. Dense
+   * graphs scan matrix rows, sparse ones go to the CsrGraph overload. Spans
+   * the component of vertex 0 with the weight of Prim's tree
+   * @return SpanTree structure with tree matrix and its weight
+   * @throws std::invalid_argument if graph is invalid or not undirected
+   */
+  static SpanTree GetSpanTreeBoruvka(const Graph& graph,
+                                     const size_t threads = 0,
+                                     MstStats* stats = nullptr);
+
+  /**
+   * @brief Parallel Boruvka's algorithm on adjacency arrays
+   * @param[in] graph Edges in both directions, like CsrGraph::FromGraph of
+   * an undirected graph
+   * @param[in] threads Worker threads, 0 - s21::thread_pool::shared()
+   * @param[out] stats Rounds and forest size, may be nullptr
+   * @return SpanTree structure with tree matrix and its weight
+   * @throws std::invalid_argument if graph has no vertices
+   */
+  static SpanTree GetSpanTreeBoruvka(const CsrGraph& graph,
+                                     const size_t threads = 0,
+                                     MstStats* stats = nullptr);
 
   /**
    * @brief Gets minimum spanning tree (Prim's or Kruskal's algorithm)
    * @param[in] graph Input graph
+   * @details Cells of a tree edge are copied from both directions of graph.
+   * GetSpanTree gives the same tree in O(V) memory
    * @return Adjacency matrix of minimum spanning tree
    */
   static Alias::IntGrid GetLeastSpanningTree(const Graph& graph);
@@ -163,6 +542,57 @@ class GraphAlgorithms {
    * @return true if graph is connected, false otherwise
    */
   static bool is_graph_connected(const Graph& graph);
+
+  /**
+   * @brief Measures edge density of graph
+   * @param[in] graph Input graph
+   * @details O(V^2) once per graph revision, repeated calls for the same
+   * revision take the remembered value
+   * @return Share of non-zero off-diagonal matrix cells (0-1)
+   */
+  static double edge_density(const Graph& graph);
+
+  /**
+   * @brief Picks the cheaper all pairs shortest paths algorithm
+   * @param[in] graph Input graph
+   * @details Compares V^3 Floyd-Warshall cell updates with
+   * V * (E + V) * log2(V) heap operations of repeated Dijkstra, weighted by
+   * Tuning::apsp_dijkstra_edge_cost
+   * @return ApspStrategy::kFloydWarshall or ApspStrategy::kDijkstra
+   */
+  static ApspStrategy pick_apsp_strategy(const Graph& graph);
+
+  /**
+   * @brief Picks minimum spanning tree algorithm
+   * @param[in] graph Input graph
+   * @return MstStrategy::kKruskal below Tuning::kruskal_max_density,
+   * MstStrategy::kPrim otherwise
+   */
+  static MstStrategy pick_mst_strategy(const Graph& graph);
+
+  /**
+   * @brief Checks if array-scan algorithms suit graph better than heap ones
+   * @param[in] graph Input graph
+   * @return true if edge density reaches Tuning::dense_graph_density
+   */
+  static bool is_dense_graph(const Graph& graph);
+
+  /**
+   * @brief Gets the largest edge weight
+   * @param[in] graph Input graph
+   * @return Max weight of graph edges read as Alias::distance, 0 if none
+   */
+  static Alias::distance max_edge_weight(const Graph& graph);
+
+  /**
+   * @brief Picks previous nodes of shortest path tree like heap Dijkstra
+   * @param[in] graph Input graph
+   * @param[in,out] path ShortPath with final distances
+   * @details Previous node of v is the first settled in-neighbour u with
+   * distance[u] + graph[u][v] == distance[v] - the smallest one by
+   * (distance, index)
+   */
+  static void set_canonical_prev_nodes(const Graph& graph, ShortPath& path);
 };
 
 /**
@@ -187,17 +617,19 @@ class Ant {
 #endif                                // TEST
   Alias::node_index start_vertex_;    ///< Starting vertex index
   Alias::node_index current_vertex_;  ///< Current vertex index
-  std::unordered_set<Alias::node_index>
-      visited_vertices_;  ///< Visited vertices
-  TsmResult ant_path_;    ///< Current path and distance
+  std::vector<bool> visited_vertices_;  ///< Visited flag of every vertex
+  TsmResult ant_path_;                  ///< Current path and distance
+  /// Unvisited neighbors of the current vertex, reused by every step
+  std::vector<Alias::node_index> candidates_;
+  /// Running sums of the candidates' choice weights, reused by every step
+  std::vector<double> cumulative_weights_;
+  s21::xoshiro256pp random_;  ///< Random stream of the ant's choices
 
   /**
-   * @brief Gets available neighboring vertices
-   * @param[in] a_graph Input graph
-   * @return Vector of available neighbor indices
+   * @brief Returns ant to its starting vertex with an empty path
+   * @details Random stream and step buffers are kept
    */
-  std::vector<Alias::node_index> get_available_neighbors(
-      const Graph& a_graph) const;
+  void reset();
 
   /**
    * @brief Calculates pheromone to deposit on path
@@ -280,16 +712,27 @@ class AntHill {
   void set_start_pheromone_(const double a_value);
   double get_start_pheromone() const { return start_pheromone_; }
   size_t get_anthill_size() const { return anthill_size_; }
+  /// Seeds ant streams, runs with the same seed and parameters are equal
+  void set_seed(const uint64_t a_seed) { seed_ = a_seed; }
+  uint64_t get_seed() const { return seed_; }
+  /// Workers building tours, 0 - the shared pool. Results do not depend on it
+  void set_threads(const size_t a_threads) { threads_ = a_threads; }
+  size_t get_threads() const { return threads_; }
 
 #ifdef TEST
  public:
 #else
  private:
 #endif
-  Graph graph_;                            ///< Input graph
+  const Graph graph_;                      ///< Input graph, read only
   Alias::PheromoneGrid pheromone_matrix_;  ///< Pheromone trail matrix
   std::vector<Ant> ant_squad_;             ///< Colony of ants
+  TsmResult best_tour_;                    ///< Shortest closed tour so far
   size_t anthill_size_;                    ///< Number of vertices in graph
+  /// Row-major (1 / weight)^beta of every edge, 0 without an edge
+  std::vector<double> heuristic_;
+  /// Row-major pheromone^alpha * heuristic_, refreshed once per iteration
+  std::vector<double> choice_weights_;
 
   // Algorithm parameters - set for better result. You can change it
   double alpha_pheromone_weight_ = 1.0;        ///< Pheromone influence weight
@@ -297,68 +740,78 @@ class AntHill {
   double q_regulation_parameter_ = 100.0;      ///< Pheromone deposit constant
   double p_pheromone_evaporation_coef_ = 0.5;  ///< Evaporation rate
   double start_pheromone_ = 1.0;               ///< Initial pheromone level
+  uint64_t seed_;                              ///< Seed of the ant streams
+  size_t threads_ = 0;                         ///< Workers building tours
 
   /**
    * @brief Initializes ant colony
+   * @details Ant i gets the stream of seed_ jumped i times, so the streams
+   * never overlap and do not depend on the order ants are run in
    */
   void prepare_ants();
 
   /**
-   * @brief Calculates greedy component of transition probability
-   * @param[in] a_ant Current ant
-   * @param[in] a_neighbor Neighbor vertex index
-   * @return Greedy component value
+   * @brief Computes greedy component of every edge into heuristic_
+   * @details Depends on the graph and beta only, no pow in the ant steps
    */
-  double greepy_part(const Ant& a_ant,
-                     const Alias::node_index a_neighbor) const;
+  void prepare_heuristic();
 
   /**
-   * @brief Calculates pheromone component of transition probability
-   * @param[in] a_ant Current ant
-   * @param[in] a_neighbor Neighbor vertex index
-   * @return Pheromone component value
+   * @brief Computes choice_weights_ from pheromone_matrix_ and heuristic_
+   * @details Called after the pheromone update of every iteration
    */
-  double herd_part(const Ant& a_ant, const Alias::node_index a_neighbor) const;
+  void update_choice_weights();
 
   /**
-   * @brief Calculates total desire to move to neighbor
+   * @brief Gets total desire to move to neighbor
    * @param[in] a_ant Current ant
    * @param[in] a_neighbor Neighbor vertex index
-   * @return Combined desire value
+   * @return Combined desire value from choice_weights_
    */
   double ant_desire_to_neighbor(const Ant& a_ant,
                                 const Alias::node_index a_neighbor) const;
 
   /**
-   * @brief Calculates transition probability to neighbor
-   * @param[in] a_ant Current ant
-   * @param[in] a_neighbor Neighbor vertex index
-   * @return Probability value (0-1)
+   * @brief Generates random number for probabilistic selection
+   * @param[in,out] a_ant Ant whose stream is drawn from
+   * @return Random value between 0 and 1
    */
-  double ant_transition_probability(const Ant& a_ant,
-                                    const Alias::node_index a_neighbor) const;
+  double random_destination(Ant& a_ant) const;
 
   /**
-   * @brief Generates random number for probabilistic selection
-   * @return Random value between 0 and 1
+   * @brief Updates pheromone trails based on ants' paths
+   * @details Same as evaporation followed by the deposit of every ant in
+   * turn: the matrix evaporates once by (1 - p)^ants in parallel rows, then
+   * deposits scaled by the evaporation after their ant are added in ant
+   * order, so the result does not depend on the number of workers. Choice
+   * weights stay as they are until update_choice_weights
+   * @param[in] a_ants Ants whose paths to use for update
+   * @param[in] a_pool Workers of the evaporation
    */
-  double random_destination() const;
+  void update_pheromone(const std::vector<Ant>& a_ants,
+                        s21::thread_pool& a_pool = s21::thread_pool::shared());
 
   /**
-   * @brief Updates pheromone trails based on ant's path
-   * @param[in] a_ant Ant whose path to use for update
+   * @brief Moves ant until its tour is closed or it is stuck
+   * @details Touches only the ant, tours of one iteration run in parallel
+   * @param[in,out] a_ant Ant at its start vertex
    */
-  void update_pheromone(const Ant& a_ant);
+  void build_tour(Ant& a_ant) const;
 
   /**
    * @brief Selects next vertex for ant to visit
-   * @param[in] a_ant Current ant
-   * @return Selected vertex index
+   * @details Roulette wheel over choice weights of the unvisited neighbors:
+   * one pass over the row fills the ant's buffers with running sums, the
+   * wheel is then searched in O(log N). Nothing is allocated once the
+   * buffers have grown
+   * @param[in,out] a_ant Current ant, its buffers are overwritten
+   * @return Selected vertex index, the current one if no neighbor is left
    */
-  Alias::node_index choose_next_vertex(const Ant& a_ant) const;
+  Alias::node_index choose_next_vertex(Ant& a_ant) const;
 
   /**
    * @brief Runs complete ant colony optimization cycle
+   * @details Tours of every iteration are built by threads_ workers
    */
   void run_ant_colony();
 };
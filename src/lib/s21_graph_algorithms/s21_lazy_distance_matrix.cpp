@@ -0,0 +1,100 @@
+/**
+ * @file s21_lazy_distance_matrix.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief All pairs distance matrix with rows computed on first access
+ */
+
+#include "s21_lazy_distance_matrix.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../s21_thread_pool/s21_thread_pool.h"
+
+namespace {
+
+// Rejects graphs which GetShortestPathsBetweenAllVertices rejects
+const Graph& checked_graph(const Graph& a_graph) {
+  if (a_graph.get_graph_size() == 0 || !a_graph.is_valid_graph())
+    throw std::invalid_argument("Invalid graph");
+  return a_graph;
+}
+
+}  // namespace
+
+LazyDistanceMatrix::LazyDistanceMatrix(const Graph& a_graph,
+                                       const size_t a_memory_limit)
+    : rows_{checked_graph(a_graph)},
+      cache_{a_memory_limit},
+      revision_{a_graph.get_revision()} {
+  if (rows_.has_negative_cycle())
+    throw std::invalid_argument("Graph has a negative cycle");
+}
+
+size_t LazyDistanceMatrix::row_bytes() const {
+  return sizeof(Alias::IntRow) + get_size() * sizeof(int);
+}
+
+void LazyDistanceMatrix::check_row(const size_t a_row) const {
+  if (a_row >= get_size()) throw std::invalid_argument("Invalid vertex value");
+}
+
+const Alias::IntRow& LazyDistanceMatrix::store(const size_t a_row,
+                                               Alias::IntRow a_distances) {
+  if (row_bytes() > cache_.capacity()) {
+    uncached_ = std::move(a_distances);
+    return uncached_;
+  }
+  return *cache_.insert(a_row, std::move(a_distances), row_bytes());
+}
+
+const Alias::IntRow& LazyDistanceMatrix::operator[](const size_t a_row) {
+  check_row(a_row);
+  if (const Alias::IntRow* row = cache_.find(a_row)) {
+    hits_++;
+    return *row;
+  }
+  misses_++;
+  Alias::IntRow distances;
+  rows_.FillRow(a_row, search_, distances);
+  return store(a_row, std::move(distances));
+}
+
+int LazyDistanceMatrix::at(const size_t a_from, const size_t a_to) {
+  check_row(a_to);
+  return (*this)[a_from][a_to];
+}
+
+bool LazyDistanceMatrix::is_cached(const size_t a_row) const {
+  return cache_.contains(a_row);
+}
+
+void LazyDistanceMatrix::Prefetch(const std::vector<size_t>& a_rows,
+                                  const size_t a_threads) {
+  std::vector<size_t> missing;
+  for (size_t row : a_rows) {
+    check_row(row);
+    if (!is_cached(row) &&
+        std::find(missing.begin(), missing.end(), row) == missing.end())
+      missing.push_back(row);
+  }
+  if (missing.empty()) return;
+
+  std::vector<Alias::IntRow> computed(missing.size());
+  auto compute = [&](s21::thread_pool& a_pool) {
+    std::vector<DijkstraRows::Search> searches(a_pool.size());
+    a_pool.parallel_for(0, missing.size(), [&](size_t index, size_t worker) {
+      rows_.FillRow(missing[index], searches[worker], computed[index]);
+    });
+  };
+  if (a_threads == 0) {
+    compute(s21::thread_pool::shared());
+  } else {
+    s21::thread_pool pool(a_threads);
+    compute(pool);
+  }
+  misses_ += missing.size();
+  for (size_t index = 0; index < missing.size(); ++index)
+    store(missing[index], std::move(computed[index]));
+}
@@ -0,0 +1,160 @@
+/**
+ * @file s21_lazy_distance_matrix.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief All pairs distance matrix with rows computed on first access
+ */
+
+#ifndef S21_LAZY_DISTANCE_MATRIX_H
+#define S21_LAZY_DISTANCE_MATRIX_H
+
+#include "../s21_lru_cache/s21_lru_cache.h"
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class LazyDistanceMatrix
+ * @brief GraphAlgorithms::GetShortestPathsBetweenAllVertices without the
+ * full grid
+ *
+ * A row is computed by one single source search when it is read for the
+ * first time and kept under a memory limit, the least recently used rows
+ * are evicted first. Queries touching few sources cost a few searches
+ * instead of O(V^3) time and O(V^2) memory. The matrix is built for the
+ * graph state at construction, get_revision tells which one.
+ */
+class LazyDistanceMatrix {
+ public:
+  /**
+   * @brief Prepares matrix of graph, no row is computed
+   * @param[in] a_graph Input graph
+   * @param[in] a_memory_limit Max bytes taken by cached rows
+   * @throws std::invalid_argument if graph is empty, invalid or has a
+   * negative cycle
+   */
+  explicit LazyDistanceMatrix(
+      const Graph& a_graph,
+      const size_t a_memory_limit = Tuning::lazy_distance_matrix_bytes);
+
+  ~LazyDistanceMatrix() = default;  ///< Default destructor
+
+  /**
+   * @brief Gets row of distances from vertex, computes it if needed
+   * @param[in] a_row Source vertex index
+   * @return Path lengths like a row of
+   * GraphAlgorithms::GetShortestPathsBetweenAllVertices, valid until the
+   * next access
+   * @throws std::invalid_argument if a_row is out of range
+   */
+  const Alias::IntRow& operator[](const size_t a_row);
+
+  /**
+   * @brief Gets distance between two vertices
+   * @param[in] a_from Source vertex index
+   * @param[in] a_to Target vertex index
+   * @return Path length, 0 if there is no path
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  int at(const size_t a_from, const size_t a_to);
+
+  /**
+   * @brief Computes missing rows in parallel
+   * @details Rows are inserted in the given order, so with a small memory
+   * limit the last ones stay cached
+   * @param[in] a_rows Source vertex indices
+   * @param[in] a_threads Number of workers, 0 for the shared pool
+   * @throws std::invalid_argument if a row is out of range
+   */
+  void Prefetch(const std::vector<size_t>& a_rows, const size_t a_threads = 0);
+
+  /**
+   * @brief Checks if row is cached
+   * @param[in] a_row Source vertex index
+   * @return true if the row is kept, does not change eviction order
+   */
+  bool is_cached(const size_t a_row) const;
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_size() const { return rows_.get_size(); }
+
+  /**
+   * @brief Gets graph revision the matrix is built for
+   * @return Revision
+   */
+  unsigned long long get_revision() const { return revision_; }
+
+  /**
+   * @brief Gets number of rows read from cache
+   * @return Hits count
+   */
+  size_t get_hits() const { return hits_; }
+
+  /**
+   * @brief Gets number of rows which were computed
+   * @return Misses count
+   */
+  size_t get_misses() const { return misses_; }
+
+  /**
+   * @brief Gets number of cached rows
+   * @return Rows count
+   */
+  size_t get_cached_rows() const { return cache_.size(); }
+
+  /**
+   * @brief Gets bytes taken by cached rows
+   * @return Memory usage
+   */
+  size_t get_memory_usage() const { return cache_.cost(); }
+
+  /**
+   * @brief Gets max bytes taken by cached rows
+   * @return Memory limit
+   */
+  size_t get_memory_limit() const { return cache_.capacity(); }
+
+  /**
+   * @brief Sets max bytes taken by cached rows, evicts rows over it
+   * @param[in] a_memory_limit Memory limit
+   */
+  void set_memory_limit(const size_t a_memory_limit) {
+    cache_.set_capacity(a_memory_limit);
+  }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  DijkstraRows rows_;                             ///< Row searches
+  s21::lru_cache<size_t, Alias::IntRow> cache_;  ///< Rows by source index
+  DijkstraRows::Search search_;                  ///< Buffers of operator[]
+  Alias::IntRow uncached_;           ///< Row too large for the limit
+  unsigned long long revision_ = 0;  ///< Graph revision of rows
+  size_t hits_ = 0;                  ///< Rows read from cache
+  size_t misses_ = 0;                ///< Rows which were computed
+
+  /**
+   * @brief Gets bytes taken by row
+   * @return Memory usage
+   */
+  size_t row_bytes() const;
+
+  /**
+   * @brief Throws if row is out of range
+   * @param[in] a_row Source vertex index
+   */
+  void check_row(const size_t a_row) const;
+
+  /**
+   * @brief Caches computed row
+   * @param[in] a_row Source vertex index
+   * @param[in] a_distances Row of distances
+   * @return Cached row, or the uncached one if it does not fit
+   */
+  const Alias::IntRow& store(const size_t a_row, Alias::IntRow a_distances);
+};
+
+#endif
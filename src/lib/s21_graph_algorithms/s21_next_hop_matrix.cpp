@@ -0,0 +1,67 @@
+/**
+ * @file s21_next_hop_matrix.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Successors on shortest paths between all pairs of vertices
+ */
+
+#include "s21_next_hop_matrix.h"
+
+#include <limits>
+#include <stdexcept>
+
+NextHopMatrix::NextHopMatrix(const size_t a_size, const size_t a_stride)
+    : size_{a_size}, stride_{std::max(a_size, a_stride)} {
+  // Every index and the missing hop have to fit the cell
+  if (a_size < UINT8_MAX)
+    cells_ = std::vector<uint8_t>(size_ * stride_, UINT8_MAX);
+  else if (a_size < UINT16_MAX)
+    cells_ = std::vector<uint16_t>(size_ * stride_, UINT16_MAX);
+  else
+    cells_ = std::vector<uint32_t>(size_ * stride_, UINT32_MAX);
+}
+
+size_t NextHopMatrix::get_cell_bytes() const {
+  return std::visit(
+      [](const auto& a_cells) { return sizeof(a_cells.front()); }, cells_);
+}
+
+size_t NextHopMatrix::get(const size_t a_from, const size_t a_to) const {
+  return std::visit(
+      [this, a_from, a_to](const auto& a_cells) {
+        using Cell = std::decay_t<decltype(a_cells.front())>;
+        const Cell hop = a_cells[a_from * stride_ + a_to];
+        return hop == std::numeric_limits<Cell>::max() ? kNoHop : hop;
+      },
+      cells_);
+}
+
+void NextHopMatrix::set(const size_t a_from, const size_t a_to,
+                        const size_t a_hop) {
+  std::visit(
+      [this, a_from, a_to, a_hop](auto& a_cells) {
+        using Cell = std::decay_t<decltype(a_cells.front())>;
+        a_cells[a_from * stride_ + a_to] =
+            a_hop == kNoHop ? std::numeric_limits<Cell>::max()
+                            : static_cast<Cell>(a_hop);
+      },
+      cells_);
+}
+
+Alias::IntRow NextHopMatrix::GetPath(const int a_vertex1,
+                                     const int a_vertex2) const {
+  if ((a_vertex1 <= 0 || static_cast<size_t>(a_vertex1) > size_) ||
+      (a_vertex2 <= 0 || static_cast<size_t>(a_vertex2) > size_))
+    throw std::invalid_argument("Invalid vertex value");
+  const size_t target = a_vertex2 - 1;
+  Alias::IntRow result;
+  if (get(a_vertex1 - 1, target) == kNoHop) return result;
+  for (size_t at = a_vertex1 - 1; at != target; at = get(at, target)) {
+    // A shortest path visits every vertex at most once
+    if (result.size() == size_ || at == kNoHop)
+      throw std::invalid_argument("Next hops do not lead to the target");
+    result.push_back(at + 1);
+  }
+  result.push_back(a_vertex2);
+  return result;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file s21_next_hop_matrix.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Successors on shortest paths between all pairs of vertices
+ */
+
+#ifndef S21_NEXT_HOP_MATRIX_H
+#define S21_NEXT_HOP_MATRIX_H
+
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+#include "../s21_graph/common.h"
+
+/**
+ * @class NextHopMatrix
+ * @brief Second vertex of a shortest path for every pair of vertices
+ *
+ * Cells take the narrowest unsigned type holding every vertex index plus the
+ * missing hop: 1 byte up to 255 vertices, 2 bytes up to 65535, 4 bytes
+ * otherwise. Rows use the stride of the DistanceMatrix they are computed
+ * with, so both are walked with the same offsets.
+ */
+class NextHopMatrix {
+ public:
+  /// Hop of a pair without a path
+  static constexpr size_t kNoHop = SIZE_MAX;
+
+  /**
+   * @brief Creates matrix without hops
+   * @param[in] a_size Number of vertices
+   * @param[in] a_stride Row stride in cells, at least a_size
+   */
+  explicit NextHopMatrix(const size_t a_size = 0, const size_t a_stride = 0);
+
+  ~NextHopMatrix() = default;  ///< Default destructor
+
+  /**
+   * @brief Gets the number of vertices
+   * @return Number of vertices
+   */
+  size_t get_size() const { return size_; }
+
+  /**
+   * @brief Gets distance between the starts of two neighbouring rows
+   * @return Row stride in cells
+   */
+  size_t get_stride() const { return stride_; }
+
+  /**
+   * @brief Gets size of one cell
+   * @return 1, 2 or 4 bytes
+   */
+  size_t get_cell_bytes() const;
+
+  /**
+   * @brief Gets the vertex following a_from on a shortest path to a_to
+   * @param[in] a_from Source vertex index
+   * @param[in] a_to Target vertex index
+   * @return Vertex index, a_from if both are equal, kNoHop without a path
+   */
+  size_t get(const size_t a_from, const size_t a_to) const;
+
+  /**
+   * @brief Sets the vertex following a_from on a shortest path to a_to
+   * @param[in] a_from Source vertex index
+   * @param[in] a_to Target vertex index
+   * @param[in] a_hop Vertex index or kNoHop
+   */
+  void set(const size_t a_from, const size_t a_to, const size_t a_hop);
+
+  /**
+   * @brief Gets shortest path by following the hops
+   * @param[in] a_vertex1 Source vertex (numeration from 1)
+   * @param[in] a_vertex2 Target vertex (numeration from 1)
+   * @details O(path length), no search is run
+   * @return Sequence of vertices like
+   * GraphAlgorithms::GetShortestVectorBetweenVertices, empty without a path
+   * @throws std::invalid_argument if a vertex is out of range or the hops
+   * loop or break off before the target
+   */
+  Alias::IntRow GetPath(const int a_vertex1, const int a_vertex2) const;
+
+  /**
+   * @brief Gets row of cells of type T
+   * @details T has to be the type picked for the matrix
+   * @param[in] a_row Row index
+   * @return Pointer to the first cell of the row
+   */
+  template <typename T>
+  T* row(const size_t a_row) {
+    return std::get<std::vector<T>>(cells_).data() + a_row * stride_;
+  }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  size_t size_;    ///< Number of vertices
+  size_t stride_;  ///< Row length with padding
+  std::variant<std::vector<uint8_t>, std::vector<uint16_t>,
+               std::vector<uint32_t>>
+      cells_;  ///< Row-major cells, maximum of the type is the missing hop
+};
+
+#endif
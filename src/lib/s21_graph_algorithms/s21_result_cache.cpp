@@ -0,0 +1,289 @@
+/**
+ * @file s21_result_cache.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief On-disk cache of algorithm results keyed by graph fingerprint
+ */
+
+#include "s21_result_cache.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Layout of the start of every result file, cells follow it
+struct FileHeader {
+  char magic[4];        // "S21R"
+  uint32_t version;     // kVersion
+  uint32_t kind;        // ResultCache::Kind
+  uint32_t reserved;    // Zero, keeps the cells 8-byte aligned
+  Fingerprint key;      // Graph fingerprint
+  uint64_t cell_count;  // Number of 32-bit cells
+  uint64_t checksum;    // Lower half of the fingerprint of the cells
+};
+
+static_assert(sizeof(FileHeader) == 48, "FileHeader layout");
+
+const char kMagic[4] = {'S', '2', '1', 'R'};
+const uint32_t kVersion = 2;
+const char kExtension[] = ".s21r";
+
+uint64_t checksum(const std::vector<int>& a_cells) {
+  FingerprintHasher hasher;
+  hasher.Update(a_cells.data(), a_cells.size());
+  return hasher.Finish().low;
+}
+
+// Appends rows of a square grid to cells
+void append_grid(const Alias::IntGrid& a_grid, std::vector<int>& a_cells) {
+  a_cells.push_back(static_cast<int>(a_grid.size()));
+  for (const Alias::IntRow& row : a_grid)
+    a_cells.insert(a_cells.end(), row.begin(), row.end());
+}
+
+// Reads a square grid written by append_grid, false if cells are too short
+bool read_grid(const std::vector<int>& a_cells, size_t& a_offset,
+               Alias::IntGrid& a_grid) {
+  if (a_offset >= a_cells.size() || a_cells[a_offset] < 0) return false;
+  const size_t size = a_cells[a_offset++];
+  if ((a_cells.size() - a_offset) / (size ? size : 1) < size) return false;
+  a_grid.assign(size, Alias::IntRow(size));
+  for (Alias::IntRow& row : a_grid) {
+    std::copy_n(a_cells.begin() + a_offset, size, row.begin());
+    a_offset += size;
+  }
+  return true;
+}
+
+// Appends tree weight, vertex count and edges of a spanning tree to cells
+void append_span_tree(const SpanTree& a_tree, std::vector<int>& a_cells) {
+  a_cells.push_back(a_tree.tree_weight);
+  a_cells.push_back(static_cast<int>(a_tree.parents.size()));
+  a_cells.push_back(static_cast<int>(a_tree.edges.size()));
+  for (const TreeEdge& edge : a_tree.edges)
+    a_cells.insert(a_cells.end(), {edge.parent, edge.child, edge.weight});
+}
+
+// Reads a spanning tree written by append_span_tree, false if cells are too
+// short or a vertex is out of range
+bool read_span_tree(const std::vector<int>& a_cells, SpanTree& a_tree) {
+  if (a_cells.size() < 3 || a_cells[1] < 0 || a_cells[2] < 0) return false;
+  const size_t size = a_cells[1], edge_count = a_cells[2];
+  if (edge_count > size || a_cells.size() != 3 + 3 * edge_count) return false;
+  a_tree = SpanTree{Alias::IntRow(size, -1), {}, a_cells[0]};
+  for (size_t offset = 3; offset < a_cells.size(); offset += 3) {
+    const TreeEdge edge{a_cells[offset], a_cells[offset + 1],
+                        a_cells[offset + 2]};
+    if (edge.parent < 0 || static_cast<size_t>(edge.parent) >= size ||
+        edge.child < 0 || static_cast<size_t>(edge.child) >= size)
+      return false;
+    a_tree.parents[edge.child] = edge.parent;
+    a_tree.edges.push_back(edge);
+  }
+  return true;
+}
+
+}  // namespace
+
+ResultCache::ResultCache(fs::path a_directory, const size_t a_disk_limit)
+    : directory_{std::move(a_directory)}, disk_limit_{a_disk_limit} {}
+
+fs::path ResultCache::UserDirectory() {
+  fs::path base;
+  const char* cache_home = std::getenv("XDG_CACHE_HOME");
+  const char* home = std::getenv("HOME");
+  // Relative paths in XDG variables are invalid and must be ignored
+  if (cache_home && fs::path(cache_home).is_absolute())
+    base = cache_home;
+  else if (home && fs::path(home).is_absolute())
+    base = fs::path(home) / ".cache";
+  else
+    return {};
+  const fs::path directory = base / "s21_navigator";
+  std::error_code error;
+  fs::create_directories(directory, error);
+  if (error || !fs::is_directory(directory, error)) return {};
+  // Result files are trusted, nobody else may plant them
+  fs::permissions(directory, fs::perms::owner_all, fs::perm_options::replace,
+                  error);
+  if (error) return {};
+  return directory;
+}
+
+fs::path ResultCache::file_path(const Fingerprint& a_key,
+                                const Kind a_kind) const {
+  return directory_ / (a_key.ToHex() + "-" +
+                       std::to_string(static_cast<uint32_t>(a_kind)) +
+                       kExtension);
+}
+
+bool ResultCache::load(const Fingerprint& a_key, const Kind a_kind,
+                       std::vector<int>& a_cells) {
+  if (!is_enabled()) return false;
+  const fs::path path = file_path(a_key, a_kind);
+  std::error_code error;
+  const uintmax_t file_size = fs::file_size(path, error);
+  if (error) return false;
+  const uintmax_t payload_size = file_size - sizeof(FileHeader);
+  FileHeader header{};
+  std::ifstream file(path, std::ios::binary);
+  bool valid = file_size >= sizeof(FileHeader) &&
+               file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+               std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+               header.version == kVersion &&
+               header.kind == static_cast<uint32_t>(a_kind) &&
+               header.key == a_key &&
+               header.cell_count == payload_size / sizeof(int) &&
+               payload_size % sizeof(int) == 0;
+  if (valid) {
+    a_cells.resize(header.cell_count);
+    valid = file.read(reinterpret_cast<char*>(a_cells.data()),
+                      a_cells.size() * sizeof(int)) &&
+            checksum(a_cells) == header.checksum;
+  }
+  file.close();
+  if (!valid) {
+    rejected_++;
+    fs::remove(path, error);
+    return false;
+  }
+  // Modification time orders files for eviction
+  fs::last_write_time(path, fs::file_time_type::clock::now(), error);
+  return true;
+}
+
+void ResultCache::store(const Fingerprint& a_key, const Kind a_kind,
+                        const std::vector<int>& a_cells) {
+  const size_t bytes = sizeof(FileHeader) + a_cells.size() * sizeof(int);
+  if (!is_enabled() || bytes > disk_limit_) return;
+  std::error_code error;
+  fs::create_directories(directory_, error);
+  if (error) return;
+  FileHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.kind = static_cast<uint32_t>(a_kind);
+  header.key = a_key;
+  header.cell_count = a_cells.size();
+  header.checksum = checksum(a_cells);
+  const fs::path path = file_path(a_key, a_kind);
+  fs::path temporary = path;
+  temporary += ".tmp";
+  {
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(a_cells.data()),
+               a_cells.size() * sizeof(int));
+    if (!file) {
+      file.close();
+      fs::remove(temporary, error);
+      return;
+    }
+  }
+  fs::rename(temporary, path, error);
+  if (error) fs::remove(temporary, error);
+  evict();
+}
+
+void ResultCache::evict() {
+  if (!is_enabled()) return;
+  struct Entry {
+    fs::file_time_type time;
+    uintmax_t size;
+    fs::path path;
+  };
+  std::vector<Entry> entries;
+  uintmax_t total = 0;
+  std::error_code error;
+  for (const fs::directory_entry& entry :
+       fs::directory_iterator(directory_, error)) {
+    if (entry.path().extension() != kExtension) continue;
+    std::error_code entry_error;
+    Entry file{entry.last_write_time(entry_error), entry.file_size(entry_error),
+               entry.path()};
+    if (entry_error) continue;
+    total += file.size;
+    entries.push_back(std::move(file));
+  }
+  if (total <= disk_limit_) return;
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.time < b.time; });
+  for (const Entry& entry : entries) {
+    if (total <= disk_limit_) break;
+    if (fs::remove(entry.path, error)) total -= entry.size;
+  }
+}
+
+size_t ResultCache::get_disk_usage() const {
+  uintmax_t total = 0;
+  if (!is_enabled()) return total;
+  std::error_code error;
+  for (const fs::directory_entry& entry :
+       fs::directory_iterator(directory_, error)) {
+    std::error_code entry_error;
+    const uintmax_t size = entry.file_size(entry_error);
+    if (entry.path().extension() == kExtension && !entry_error) total += size;
+  }
+  return total;
+}
+
+void ResultCache::set_disk_limit(const size_t a_disk_limit) {
+  disk_limit_ = a_disk_limit;
+  evict();
+}
+
+void ResultCache::clear() {
+  if (!is_enabled()) return;
+  std::vector<fs::path> files;
+  std::error_code error;
+  for (const fs::directory_entry& entry :
+       fs::directory_iterator(directory_, error)) {
+    if (entry.path().extension() == kExtension) files.push_back(entry.path());
+  }
+  for (const fs::path& path : files) fs::remove(path, error);
+}
+
+Alias::IntGrid ResultCache::GetShortestPathsBetweenAllVertices(
+    const Graph& a_graph) {
+  // The fingerprint does not cover validity, invalid graphs throw
+  if (!a_graph.is_valid_graph())
+    return GraphAlgorithms::GetShortestPathsBetweenAllVertices(a_graph);
+  const Fingerprint key = a_graph.get_fingerprint();
+  std::vector<int> cells;
+  Alias::IntGrid result;
+  size_t offset = 0;
+  if (load(key, Kind::kApsp, cells) && read_grid(cells, offset, result)) {
+    hits_++;
+    return result;
+  }
+  misses_++;
+  result = GraphAlgorithms::GetShortestPathsBetweenAllVertices(a_graph);
+  cells.clear();
+  append_grid(result, cells);
+  store(key, Kind::kApsp, cells);
+  return result;
+}
+
+SpanTree ResultCache::GetSpanTree(const Graph& a_graph) {
+  // The fingerprint does not cover validity, invalid graphs throw
+  if (!a_graph.is_valid_graph())
+    return GraphAlgorithms::GetSpanTree(a_graph);
+  const Fingerprint key = a_graph.get_fingerprint();
+  std::vector<int> cells;
+  SpanTree result{};
+  if (load(key, Kind::kSpanTree, cells) && read_span_tree(cells, result)) {
+    hits_++;
+    return result;
+  }
+  misses_++;
+  result = GraphAlgorithms::GetSpanTree(a_graph);
+  cells.clear();
+  append_span_tree(result, cells);
+  store(key, Kind::kSpanTree, cells);
+  return result;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file s21_result_cache.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief On-disk cache of algorithm results keyed by graph fingerprint
+ */
+
+#ifndef S21_RESULT_CACHE_H
+#define S21_RESULT_CACHE_H
+
+#include <filesystem>
+
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class ResultCache
+ * @brief GraphAlgorithms results which survive process restarts
+ *
+ * Only deterministic algorithms are kept, a randomized result would be
+ * replayed for the graph forever.
+ * Every result is one file of the cache directory named by the graph
+ * fingerprint and the algorithm. A file is a fixed 48-byte header (magic,
+ * format version, algorithm, fingerprint, cell count, checksum) followed by
+ * 32-bit cells, so it can be read with one call or mapped into memory.
+ * Files with a wrong header, size or checksum are removed and recomputed.
+ * Files are written under a temporary name and renamed, a crash never
+ * leaves half a result. When the directory grows over the limit the least
+ * recently used files are removed. A cache without a directory keeps
+ * nothing and computes every result.
+ */
+class ResultCache {
+ public:
+  /**
+   * @brief Opens cache directory, it is created on the first store
+   * @param[in] a_directory Cache directory, empty - results are not kept
+   * @param[in] a_disk_limit Max bytes taken by result files
+   */
+  explicit ResultCache(std::filesystem::path a_directory,
+                       const size_t a_disk_limit = Tuning::result_cache_bytes);
+
+  ~ResultCache() = default;  ///< Default destructor
+
+  /**
+   * @brief Finds cache directory of the current user
+   * @details $XDG_CACHE_HOME/s21_navigator, ~/.cache/s21_navigator if the
+   * variable is unset or relative. The directory is created and made
+   * accessible to its owner only. Never throws
+   * @return Directory path, empty if there is no usable directory
+   */
+  static std::filesystem::path UserDirectory();
+
+  /**
+   * @brief Gets cached or computes all pairs shortest paths
+   * @param[in] a_graph Input graph
+   * @return Like GraphAlgorithms::GetShortestPathsBetweenAllVertices
+   * @throws std::invalid_argument like the algorithm
+   */
+  Alias::IntGrid GetShortestPathsBetweenAllVertices(const Graph& a_graph);
+
+  /**
+   * @brief Gets cached or computes minimum spanning tree
+   * @param[in] a_graph Input graph
+   * @return Like GraphAlgorithms::GetSpanTree
+   * @throws std::invalid_argument like the algorithm
+   */
+  SpanTree GetSpanTree(const Graph& a_graph);
+
+  /**
+   * @brief Removes all result files, counters are kept
+   */
+  void clear();
+
+  /**
+   * @brief Gets number of results read from disk
+   * @return Hits count
+   */
+  size_t get_hits() const { return hits_; }
+
+  /**
+   * @brief Gets number of results which were computed
+   * @return Misses count
+   */
+  size_t get_misses() const { return misses_; }
+
+  /**
+   * @brief Gets number of damaged files which were removed
+   * @return Rejected files count
+   */
+  size_t get_rejected() const { return rejected_; }
+
+  /**
+   * @brief Gets bytes taken by result files
+   * @return Disk usage
+   */
+  size_t get_disk_usage() const;
+
+  /**
+   * @brief Gets max bytes taken by result files
+   * @return Disk limit
+   */
+  size_t get_disk_limit() const { return disk_limit_; }
+
+  /**
+   * @brief Sets max bytes taken by result files, removes files over it
+   * @param[in] a_disk_limit Disk limit
+   */
+  void set_disk_limit(const size_t a_disk_limit);
+
+  /**
+   * @brief Gets cache directory
+   * @return Directory path, empty if results are not kept
+   */
+  const std::filesystem::path& get_directory() const { return directory_; }
+
+  /**
+   * @brief Checks if results are kept on disk
+   * @return true if the cache has a directory
+   */
+  bool is_enabled() const { return !directory_.empty(); }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  /**
+   * @brief Algorithm of a result file
+   */
+  enum class Kind : uint32_t { kApsp = 1, kSpanTree = 2 };
+
+  std::filesystem::path directory_;  ///< Cache directory
+  size_t disk_limit_;                ///< Max bytes of result files
+  size_t hits_ = 0;                  ///< Results read from disk
+  size_t misses_ = 0;                ///< Results which were computed
+  size_t rejected_ = 0;              ///< Damaged files removed
+
+  /**
+   * @brief Gets path of result file
+   * @param[in] a_key Graph fingerprint
+   * @param[in] a_kind Algorithm
+   * @return File path
+   */
+  std::filesystem::path file_path(const Fingerprint& a_key,
+                                  const Kind a_kind) const;
+
+  /**
+   * @brief Reads and checks result file
+   * @param[in] a_key Graph fingerprint
+   * @param[in] a_kind Algorithm
+   * @param[out] a_cells Cells of the result
+   * @return true if a valid file was read
+   */
+  bool load(const Fingerprint& a_key, const Kind a_kind,
+            std::vector<int>& a_cells);
+
+  /**
+   * @brief Writes result file, then removes files over the limit
+   * @param[in] a_key Graph fingerprint
+   * @param[in] a_kind Algorithm
+   * @param[in] a_cells Cells of the result
+   */
+  void store(const Fingerprint& a_key, const Kind a_kind,
+             const std::vector<int>& a_cells);
+
+  /**
+   * @brief Removes least recently used files over the limit
+   */
+  void evict();
+};
+
+#endif
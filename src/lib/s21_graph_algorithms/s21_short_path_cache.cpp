@@ -0,0 +1,56 @@
+/**
+ * @file s21_short_path_cache.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief LRU cache of shortest path trees keyed by source vertex
+ */
+
+#include "s21_short_path_cache.h"
+
+ShortPathCache::ShortPathCache(const size_t a_memory_limit)
+    : trees_{a_memory_limit} {}
+
+size_t ShortPathCache::tree_bytes(const ShortPath& a_tree) {
+  return sizeof(ShortPath) +
+         a_tree.distances.capacity() * sizeof(Alias::distance) +
+         a_tree.prev_nodes.capacity() * sizeof(int);
+}
+
+const ShortPath& ShortPathCache::GetShortPath(const Graph& a_graph,
+                                              const int a_start_index) {
+  if (a_graph.get_revision() != revision_) {
+    trees_.clear();
+    revision_ = a_graph.get_revision();
+  }
+  if (const ShortPath* tree = trees_.find(a_start_index)) {
+    hits_++;
+    return *tree;
+  }
+  misses_++;
+  ShortPath tree = GraphAlgorithms::GetShortPath(a_graph, a_start_index);
+  const size_t bytes = tree_bytes(tree);
+  if (bytes > trees_.capacity()) {
+    uncached_ = std::move(tree);
+    return uncached_;
+  }
+  return *trees_.insert(a_start_index, std::move(tree), bytes);
+}
+
+RouteResult ShortPathCache::GetShortestRouteBetweenVertices(
+    const Graph& a_graph, const int a_vertex1, const int a_vertex2) {
+  const size_t size = a_graph.get_graph_size();
+  if ((a_vertex1 <= 0 || static_cast<size_t>(a_vertex1) > size) ||
+      (a_vertex2 <= 0 || static_cast<size_t>(a_vertex2) > size))
+    throw std::invalid_argument("Invalid vertex value");
+  const int end = a_vertex2 - 1;
+  const ShortPath& tree = GetShortPath(a_graph, a_vertex1 - 1);
+  RouteResult result{tree.distances[end], {}};
+  if (result.distance != UINT_MAX) {
+    for (int at = end; at != -1; at = tree.prev_nodes[at])
+      result.vertices.push_back(at + 1);
+    std::reverse(result.vertices.begin(), result.vertices.end());
+  }
+  return result;
+}
+
+void ShortPathCache::clear() { trees_.clear(); }
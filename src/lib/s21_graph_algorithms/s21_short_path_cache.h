@@ -0,0 +1,118 @@
+/**
+ * @file s21_short_path_cache.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief LRU cache of shortest path trees keyed by source vertex
+ */
+
+#ifndef S21_SHORT_PATH_CACHE_H
+#define S21_SHORT_PATH_CACHE_H
+
+#include "../s21_lru_cache/s21_lru_cache.h"
+#include "s21_graph_algorithms.h"
+
+/**
+ * @class ShortPathCache
+ * @brief Memoized GraphAlgorithms::GetShortPath trees of one graph
+ *
+ * Trees are kept for the graph revision they were computed for. A query
+ * with another revision (graph modified through operator[], reloaded or
+ * another graph) drops all of them. Memory taken by trees is bounded, the
+ * least recently used trees are evicted first.
+ */
+class ShortPathCache {
+ public:
+  /**
+   * @brief Creates empty cache
+   * @param[in] a_memory_limit Max bytes taken by cached trees
+   */
+  explicit ShortPathCache(
+      const size_t a_memory_limit = Tuning::short_path_cache_bytes);
+
+  ~ShortPathCache() = default;  ///< Default destructor
+
+  /**
+   * @brief Gets full shortest path tree from source vertex
+   * @param[in] a_graph Input graph
+   * @param[in] a_start_index Source vertex index
+   * @return ShortPath like GraphAlgorithms::GetShortPath, valid until the
+   * next call
+   */
+  const ShortPath& GetShortPath(const Graph& a_graph, const int a_start_index);
+
+  /**
+   * @brief Gets shortest route between two vertices from cached tree
+   * @param[in] a_graph Input graph
+   * @param[in] a_vertex1 Source vertex (numeration from 1)
+   * @param[in] a_vertex2 Target vertex (numeration from 1)
+   * @details O(route length) when the tree of a_vertex1 is cached
+   * @return RouteResult like GraphAlgorithms::GetShortestRouteBetweenVertices
+   * @throws std::invalid_argument if a vertex is out of range
+   */
+  RouteResult GetShortestRouteBetweenVertices(const Graph& a_graph,
+                                              const int a_vertex1,
+                                              const int a_vertex2);
+
+  /**
+   * @brief Drops all trees, counters are kept
+   */
+  void clear();
+
+  /**
+   * @brief Gets number of queries answered from cache
+   * @return Hits count
+   */
+  size_t get_hits() const { return hits_; }
+
+  /**
+   * @brief Gets number of queries which computed a tree
+   * @return Misses count
+   */
+  size_t get_misses() const { return misses_; }
+
+  /**
+   * @brief Gets number of cached trees
+   * @return Trees count
+   */
+  size_t get_size() const { return trees_.size(); }
+
+  /**
+   * @brief Gets bytes taken by cached trees
+   * @return Memory usage
+   */
+  size_t get_memory_usage() const { return trees_.cost(); }
+
+  /**
+   * @brief Gets max bytes taken by cached trees
+   * @return Memory limit
+   */
+  size_t get_memory_limit() const { return trees_.capacity(); }
+
+  /**
+   * @brief Sets max bytes taken by cached trees, evicts trees over it
+   * @param[in] a_memory_limit Memory limit
+   */
+  void set_memory_limit(const size_t a_memory_limit) {
+    trees_.set_capacity(a_memory_limit);
+  }
+
+#ifdef TEST
+ public:
+#else
+ private:
+#endif  // TEST
+  s21::lru_cache<int, ShortPath> trees_;  ///< Trees by source vertex index
+  unsigned long long revision_ = 0;       ///< Graph revision of trees
+  ShortPath uncached_;                    ///< Tree too large for the limit
+  size_t hits_ = 0;                       ///< Queries answered from cache
+  size_t misses_ = 0;                     ///< Queries which computed a tree
+
+  /**
+   * @brief Estimates bytes taken by tree
+   * @param[in] a_tree Shortest path tree
+   * @return Memory usage
+   */
+  static size_t tree_bytes(const ShortPath& a_tree);
+};
+
+#endif
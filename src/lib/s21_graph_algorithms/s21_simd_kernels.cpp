@@ -0,0 +1,376 @@
+/**
+ * @file s21_simd_kernels.cpp
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Vectorized inner loops used by graph algorithms
+ */
+
+#include "s21_simd_kernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Scalar versions - reference behaviour and tails of the vector loops
+
+size_t argmin_scalar(const Alias::distance* a_keys, size_t a_begin,
+                     const size_t a_size, Alias::distance& a_min) {
+  size_t result = a_size;
+  for (size_t i = a_begin; i < a_size; ++i) {
+    if (a_keys[i] < a_min) {
+      a_min = a_keys[i];
+      result = i;
+    }
+  }
+  return result;
+}
+
+void relax_row_scalar(const int* a_row, const Alias::distance* a_settled,
+                      const Alias::distance a_base, const int a_from,
+                      Alias::distance* a_keys, int* a_prev, size_t a_begin,
+                      const size_t a_size) {
+  for (size_t j = a_begin; j < a_size; ++j) {
+    Alias::distance candidate = a_base + static_cast<Alias::distance>(a_row[j]);
+    if (a_row[j] != 0 && a_settled[j] == 0 && candidate < a_keys[j]) {
+      a_keys[j] = candidate;
+      a_prev[j] = a_from;
+    }
+  }
+}
+
+// One row of min_plus: a_c[j] = min(a_c[j], a_to_k + a_from_k[j])
+template <typename T>
+void min_plus_row_scalar(T* a_c, const T a_to_k, const T* a_from_k,
+                         size_t a_begin, const size_t a_columns) {
+  for (size_t j = a_begin; j < a_columns; ++j) {
+    T candidate = a_to_k + a_from_k[j];
+    if constexpr (sizeof(T) == sizeof(uint16_t)) {
+      // Saturating add - wrapped sums are smaller than the operand
+      if (candidate < a_to_k) candidate = UINT16_MAX;
+    }
+    a_c[j] = std::min(a_c[j], candidate);
+  }
+}
+
+template <typename T>
+void min_plus_scalar(T* a_c, const T* a_a, const T* a_b, const size_t a_stride,
+                     const size_t a_rows, const size_t a_columns,
+                     const size_t a_depth, const T a_infinity) {
+  for (size_t k = 0; k < a_depth; ++k) {
+    const T* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const T to_k = a_a[i * a_stride + k];
+      if (to_k == a_infinity) continue;
+      min_plus_row_scalar(a_c + i * a_stride, to_k, from_k, 0, a_columns);
+    }
+  }
+}
+
+#ifdef S21_SIMD_X86
+
+__attribute__((target("avx2"))) inline __m256i load_256(const void* a_src) {
+  return _mm256_loadu_si256(static_cast<const __m256i*>(a_src));
+}
+
+__attribute__((target("avx2"))) inline void store_256(void* a_dst,
+                                                      __m256i a_value) {
+  _mm256_storeu_si256(static_cast<__m256i*>(a_dst), a_value);
+}
+
+__attribute__((target("avx2"))) size_t argmin_avx2(
+    const Alias::distance* a_keys, const size_t a_size) {
+  // First pass - minimal value, second pass - its first position
+  __m256i min_vec = _mm256_set1_epi32(-1);
+  size_t i = 0;
+  for (; i + 8 <= a_size; i += 8) {
+    min_vec = _mm256_min_epu32(min_vec, load_256(a_keys + i));
+  }
+  alignas(32) Alias::distance lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), min_vec);
+  Alias::distance min_value = UINT_MAX;
+  for (Alias::distance lane : lanes) min_value = std::min(min_value, lane);
+  for (size_t j = i; j < a_size; ++j) {
+    min_value = std::min(min_value, a_keys[j]);
+  }
+  if (min_value == UINT_MAX) return a_size;
+
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(min_value));
+  for (i = 0; i + 8 <= a_size; i += 8) {
+    int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(load_256(a_keys + i), needle)));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  for (; i < a_size; ++i) {
+    if (a_keys[i] == min_value) return i;
+  }
+  return a_size;
+}
+
+__attribute__((target("avx2"))) void relax_row_avx2(
+    const int* a_row, const Alias::distance* a_settled,
+    const Alias::distance a_base, const int a_from, Alias::distance* a_keys,
+    int* a_prev, const size_t a_size) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i sign = _mm256_set1_epi32(INT_MIN);
+  const __m256i base = _mm256_set1_epi32(static_cast<int>(a_base));
+  const __m256i from = _mm256_set1_epi32(a_from);
+  size_t j = 0;
+  for (; j + 8 <= a_size; j += 8) {
+    __m256i weights = load_256(a_row + j);
+    __m256i keys = load_256(a_keys + j);
+    __m256i candidate = _mm256_add_epi32(base, weights);
+    // Unsigned candidate < key through the signed compare of biased values
+    __m256i better = _mm256_cmpgt_epi32(_mm256_xor_si256(keys, sign),
+                                        _mm256_xor_si256(candidate, sign));
+    __m256i closed = _mm256_or_si256(load_256(a_settled + j),
+                                     _mm256_cmpeq_epi32(weights, zero));
+    __m256i mask = _mm256_andnot_si256(closed, better);
+    if (_mm256_testz_si256(mask, mask)) continue;
+    store_256(a_keys + j, _mm256_blendv_epi8(keys, candidate, mask));
+    store_256(a_prev + j, _mm256_blendv_epi8(load_256(a_prev + j), from, mask));
+  }
+  relax_row_scalar(a_row, a_settled, a_base, a_from, a_keys, a_prev, j, a_size);
+}
+
+__attribute__((target("avx2"))) void min_plus_avx2(
+    int* a_c, const int* a_a, const int* a_b, const size_t a_stride,
+    const size_t a_rows, const size_t a_columns, const size_t a_depth) {
+  for (size_t k = 0; k < a_depth; ++k) {
+    const int* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const int to_k = a_a[i * a_stride + k];
+      if (to_k == Simd::saturated_infinity) continue;
+      int* c = a_c + i * a_stride;
+      const __m256i base = _mm256_set1_epi32(to_k);
+      size_t j = 0;
+      for (; j + 8 <= a_columns; j += 8) {
+        __m256i sum = _mm256_add_epi32(base, load_256(from_k + j));
+        store_256(c + j, _mm256_min_epi32(load_256(c + j), sum));
+      }
+      min_plus_row_scalar(c, to_k, from_k, j, a_columns);
+    }
+  }
+}
+
+__attribute__((target("avx2"))) void min_plus_avx2(
+    uint16_t* a_c, const uint16_t* a_a, const uint16_t* a_b,
+    const size_t a_stride, const size_t a_rows, const size_t a_columns,
+    const size_t a_depth) {
+  for (size_t k = 0; k < a_depth; ++k) {
+    const uint16_t* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const uint16_t to_k = a_a[i * a_stride + k];
+      if (to_k == UINT16_MAX) continue;
+      uint16_t* c = a_c + i * a_stride;
+      const __m256i base = _mm256_set1_epi16(static_cast<short>(to_k));
+      size_t j = 0;
+      for (; j + 16 <= a_columns; j += 16) {
+        __m256i sum = _mm256_adds_epu16(base, load_256(from_k + j));
+        store_256(c + j, _mm256_min_epu16(load_256(c + j), sum));
+      }
+      min_plus_row_scalar(c, to_k, from_k, j, a_columns);
+    }
+  }
+}
+
+__attribute__((target("avx512f"))) size_t argmin_avx512(
+    const Alias::distance* a_keys, const size_t a_size) {
+  __m512i min_vec = _mm512_set1_epi32(-1);
+  size_t i = 0;
+  for (; i + 16 <= a_size; i += 16) {
+    min_vec = _mm512_min_epu32(min_vec, _mm512_loadu_si512(a_keys + i));
+  }
+  Alias::distance min_value =
+      static_cast<Alias::distance>(_mm512_reduce_min_epu32(min_vec));
+  for (size_t j = i; j < a_size; ++j) {
+    min_value = std::min(min_value, a_keys[j]);
+  }
+  if (min_value == UINT_MAX) return a_size;
+
+  const __m512i needle = _mm512_set1_epi32(static_cast<int>(min_value));
+  for (i = 0; i + 16 <= a_size; i += 16) {
+    __mmask16 mask =
+        _mm512_cmpeq_epu32_mask(_mm512_loadu_si512(a_keys + i), needle);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  for (; i < a_size; ++i) {
+    if (a_keys[i] == min_value) return i;
+  }
+  return a_size;
+}
+
+__attribute__((target("avx512f"))) void relax_row_avx512(
+    const int* a_row, const Alias::distance* a_settled,
+    const Alias::distance a_base, const int a_from, Alias::distance* a_keys,
+    int* a_prev, const size_t a_size) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i base = _mm512_set1_epi32(static_cast<int>(a_base));
+  const __m512i from = _mm512_set1_epi32(a_from);
+  size_t j = 0;
+  for (; j + 16 <= a_size; j += 16) {
+    __m512i weights = _mm512_loadu_si512(a_row + j);
+    __m512i keys = _mm512_loadu_si512(a_keys + j);
+    __m512i candidate = _mm512_add_epi32(base, weights);
+    __m512i settled = _mm512_loadu_si512(a_settled + j);
+    __mmask16 mask = _mm512_cmpneq_epi32_mask(weights, zero) &
+                     _mm512_cmpeq_epi32_mask(settled, zero) &
+                     _mm512_cmplt_epu32_mask(candidate, keys);
+    if (mask == 0) continue;
+    _mm512_mask_storeu_epi32(a_keys + j, mask, candidate);
+    _mm512_mask_storeu_epi32(a_prev + j, mask, from);
+  }
+  relax_row_scalar(a_row, a_settled, a_base, a_from, a_keys, a_prev, j, a_size);
+}
+
+__attribute__((target("avx512f"))) void min_plus_avx512(
+    int* a_c, const int* a_a, const int* a_b, const size_t a_stride,
+    const size_t a_rows, const size_t a_columns, const size_t a_depth) {
+  for (size_t k = 0; k < a_depth; ++k) {
+    const int* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const int to_k = a_a[i * a_stride + k];
+      if (to_k == Simd::saturated_infinity) continue;
+      int* c = a_c + i * a_stride;
+      const __m512i base = _mm512_set1_epi32(to_k);
+      size_t j = 0;
+      for (; j + 16 <= a_columns; j += 16) {
+        __m512i sum = _mm512_add_epi32(base, _mm512_loadu_si512(from_k + j));
+        _mm512_storeu_si512(c + j,
+                            _mm512_min_epi32(_mm512_loadu_si512(c + j), sum));
+      }
+      min_plus_row_scalar(c, to_k, from_k, j, a_columns);
+    }
+  }
+}
+
+__attribute__((target("avx512f,avx512bw"))) void min_plus_avx512(
+    uint16_t* a_c, const uint16_t* a_a, const uint16_t* a_b,
+    const size_t a_stride, const size_t a_rows, const size_t a_columns,
+    const size_t a_depth) {
+  for (size_t k = 0; k < a_depth; ++k) {
+    const uint16_t* from_k = a_b + k * a_stride;
+    for (size_t i = 0; i < a_rows; ++i) {
+      const uint16_t to_k = a_a[i * a_stride + k];
+      if (to_k == UINT16_MAX) continue;
+      uint16_t* c = a_c + i * a_stride;
+      const __m512i base = _mm512_set1_epi16(static_cast<short>(to_k));
+      size_t j = 0;
+      for (; j + 32 <= a_columns; j += 32) {
+        __m512i sum = _mm512_adds_epu16(base, _mm512_loadu_si512(from_k + j));
+        _mm512_storeu_si512(c + j,
+                            _mm512_min_epu16(_mm512_loadu_si512(c + j), sum));
+      }
+      min_plus_row_scalar(c, to_k, from_k, j, a_columns);
+    }
+  }
+}
+
+#endif  // S21_SIMD_X86
+
+Simd::Level detect() {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return Simd::Level::kAvx512;
+  if (__builtin_cpu_supports("avx2")) return Simd::Level::kAvx2;
+#endif
+  return Simd::Level::kScalar;
+}
+
+std::atomic<Simd::Level>& active_level() {
+  static std::atomic<Simd::Level> level{Simd::detected_level()};
+  return level;
+}
+
+}  // namespace
+
+Simd::Level Simd::detected_level() {
+  static const Level level = detect();
+  return level;
+}
+
+Simd::Level Simd::get_level() { return active_level().load(); }
+
+void Simd::set_level(const Level a_level) {
+  active_level().store(std::min(a_level, detected_level()));
+}
+
+size_t Simd::argmin(const Alias::distance* a_keys, const size_t a_size) {
+#ifdef S21_SIMD_X86
+  switch (get_level()) {
+    case Level::kAvx512:
+      return argmin_avx512(a_keys, a_size);
+    case Level::kAvx2:
+      return argmin_avx2(a_keys, a_size);
+    default:
+      break;
+  }
+#endif
+  Alias::distance min_value = UINT_MAX;
+  return argmin_scalar(a_keys, 0, a_size, min_value);
+}
+
+void Simd::relax_row(const int* a_row, const Alias::distance* a_settled,
+                     const Alias::distance a_base, const int a_from,
+                     Alias::distance* a_keys, int* a_prev,
+                     const size_t a_size) {
+#ifdef S21_SIMD_X86
+  switch (get_level()) {
+    case Level::kAvx512:
+      return relax_row_avx512(a_row, a_settled, a_base, a_from, a_keys, a_prev,
+                              a_size);
+    case Level::kAvx2:
+      return relax_row_avx2(a_row, a_settled, a_base, a_from, a_keys, a_prev,
+                            a_size);
+    default:
+      break;
+  }
+#endif
+  relax_row_scalar(a_row, a_settled, a_base, a_from, a_keys, a_prev, 0,
+                   a_size);
+}
+
+void Simd::min_plus(int* a_c, const int* a_a, const int* a_b,
+                    const size_t a_stride, const size_t a_rows,
+                    const size_t a_columns, const size_t a_depth) {
+#ifdef S21_SIMD_X86
+  switch (get_level()) {
+    case Level::kAvx512:
+      return min_plus_avx512(a_c, a_a, a_b, a_stride, a_rows, a_columns,
+                             a_depth);
+    case Level::kAvx2:
+      return min_plus_avx2(a_c, a_a, a_b, a_stride, a_rows, a_columns,
+                           a_depth);
+    default:
+      break;
+  }
+#endif
+  min_plus_scalar(a_c, a_a, a_b, a_stride, a_rows, a_columns, a_depth,
+                  saturated_infinity);
+}
+
+void Simd::min_plus(uint16_t* a_c, const uint16_t* a_a, const uint16_t* a_b,
+                    const size_t a_stride, const size_t a_rows,
+                    const size_t a_columns, const size_t a_depth) {
+#ifdef S21_SIMD_X86
+  switch (get_level()) {
+    case Level::kAvx512:
+      return min_plus_avx512(a_c, a_a, a_b, a_stride, a_rows, a_columns,
+                             a_depth);
+    case Level::kAvx2:
+      return min_plus_avx2(a_c, a_a, a_b, a_stride, a_rows, a_columns,
+                           a_depth);
+    default:
+      break;
+  }
+#endif
+  min_plus_scalar<uint16_t>(a_c, a_a, a_b, a_stride, a_rows, a_columns,
+                            a_depth, UINT16_MAX);
+}
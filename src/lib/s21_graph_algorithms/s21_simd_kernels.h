@@ -0,0 +1,114 @@
+/**
+ * @file s21_simd_kernels.h
+ * @author montoyay (https://t.me/tdutanton)
+ * @author buggkell (https://t.me/a_a_sorokina)
+ * @brief Vectorized inner loops used by graph algorithms
+ *
+ * Every kernel has a scalar version and AVX2/AVX-512 versions. The
+ * vectorized versions are compiled with per-function target attributes and
+ * are chosen at runtime, so the library itself is built without any -m flags.
+ */
+
+#ifndef S21_SIMD_KERNELS_H
+#define S21_SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../s21_graph/common.h"
+
+/**
+ * @namespace Simd
+ * @brief Runtime dispatched vector kernels
+ */
+namespace Simd {
+
+/// Missing path of the 32-bit min_plus kernel, twice of it still fits an int
+static constexpr int saturated_infinity = (1 << 30) - 1;
+
+/**
+ * @enum Level
+ * @brief Instruction set used by the kernels
+ */
+enum class Level {
+  kScalar,  ///< Plain C++ loops
+  kAvx2,    ///< 256-bit AVX2 kernels
+  kAvx512   ///< 512-bit AVX-512 kernels
+};
+
+/**
+ * @brief Gets the best instruction set supported by the current CPU
+ * @return Detected level
+ */
+Level detected_level();
+
+/**
+ * @brief Gets the instruction set currently used by the kernels
+ * @return Active level
+ */
+Level get_level();
+
+/**
+ * @brief Restricts the kernels to the given instruction set
+ * @param[in] a_level Wanted level, clamped to the detected one
+ */
+void set_level(const Level a_level);
+
+/**
+ * @brief Finds the first minimal key
+ * @param[in] a_keys Array of keys
+ * @param[in] a_size Number of keys
+ * @return Index of the first minimal key or a_size if every key is UINT_MAX
+ */
+size_t argmin(const Alias::distance* a_keys, const size_t a_size);
+
+/**
+ * @brief Relaxes a row of the adjacency matrix with masked updates
+ * @details For every j with a_row[j] != 0, a_settled[j] == 0 and
+ * a_base + a_row[j] < a_keys[j] sets a_keys[j] = a_base + a_row[j] and
+ * a_prev[j] = a_from. Weights are taken as unsigned, like in the heap
+ * versions of the algorithms. Dijkstra passes the distance of a_from as
+ * a_base, Prim passes 0.
+ * @param[in] a_row Row of the adjacency matrix
+ * @param[in] a_settled 0 for open vertices, UINT_MAX for settled ones
+ * @param[in] a_base Value added to every edge weight
+ * @param[in] a_from Vertex the row belongs to
+ * @param[in,out] a_keys Tentative keys of the vertices
+ * @param[in,out] a_prev Previous nodes of the vertices
+ * @param[in] a_size Row length
+ */
+void relax_row(const int* a_row, const Alias::distance* a_settled,
+               const Alias::distance a_base, const int a_from,
+               Alias::distance* a_keys, int* a_prev, const size_t a_size);
+
+/**
+ * @brief Relaxes a tile of a distance matrix through intermediate vertices
+ * @details For every k < a_depth in order and every i < a_rows,
+ * j < a_columns sets a_c[i][j] = min(a_c[i][j], a_a[i][k] + a_b[k][j]).
+ * Missing paths are saturated_infinity and every finite path must be shorter,
+ * so a sum with a missing path never wins and no branches are needed. Tiles
+ * may overlap like in the phases of blocked Floyd-Warshall.
+ * @param[in,out] a_c First cell of the updated tile
+ * @param[in] a_a First cell of the tile with paths to intermediate vertices
+ * @param[in] a_b First cell of the tile with paths from intermediate vertices
+ * @param[in] a_stride Row stride of the matrix
+ * @param[in] a_rows Rows of the updated tile
+ * @param[in] a_columns Columns of the updated tile
+ * @param[in] a_depth Number of intermediate vertices
+ */
+void min_plus(int* a_c, const int* a_a, const int* a_b, const size_t a_stride,
+              const size_t a_rows, const size_t a_columns,
+              const size_t a_depth);
+
+/**
+ * @brief 16-bit version of min_plus
+ * @details Sums saturate at UINT16_MAX, which is the missing path, so every
+ * finite path must be shorter than it
+ */
+void min_plus(uint16_t* a_c, const uint16_t* a_a, const uint16_t* a_b,
+              const size_t a_stride, const size_t a_rows,
+              const size_t a_columns, const size_t a_depth);
+
+};  // namespace Simd
+
+#endif
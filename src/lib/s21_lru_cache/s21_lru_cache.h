@@ -0,0 +1,58 @@
+#ifndef S21_LRU_CACHE_H
+#define S21_LRU_CACHE_H
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace s21 {
+
+// Key-value cache bounded by the total cost of its entries. Every entry has
+// a cost (1 by default, e.g. bytes), the least recently used entries are
+// evicted while the total is above the capacity.
+template <typename Key, typename T>
+class lru_cache {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = size_t;
+
+  explicit lru_cache(size_type a_capacity);  // max total cost
+
+  size_type size() const;      // number of entries
+  size_type cost() const;      // total cost of entries
+  size_type capacity() const;  // max total cost
+  bool empty() const;
+  // true if key is present, does not mark it as used
+  bool contains(const key_type &a_key) const;
+
+  // returns value and marks it as the most recently used, nullptr if absent
+  mapped_type *find(const key_type &a_key);
+  // inserts or replaces value, returns it or nullptr if a_cost > capacity
+  mapped_type *insert(const key_type &a_key, mapped_type a_value,
+                      size_type a_cost = 1);
+  bool erase(const key_type &a_key);  // true if key was present
+  void clear();
+  void set_capacity(size_type a_capacity);  // evicts entries over it
+
+ private:
+  struct entry {
+    key_type key;
+    mapped_type value;
+    size_type cost;
+  };
+
+  void evict();  // drops least recently used entries over capacity
+
+  std::list<entry> entries_;  // most recently used first
+  std::unordered_map<key_type, typename std::list<entry>::iterator> index_;
+  size_type capacity_;
+  size_type cost_;
+};
+
+}  // namespace s21
+
+#include "s21_lru_cache.tpp"
+
+#endif
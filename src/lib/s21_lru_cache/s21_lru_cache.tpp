@@ -0,0 +1,87 @@
+#include "s21_lru_cache.h"
+
+namespace s21 {
+
+template <typename Key, typename T>
+lru_cache<Key, T>::lru_cache(size_type a_capacity)
+    : capacity_(a_capacity), cost_(0) {}
+
+template <typename Key, typename T>
+typename lru_cache<Key, T>::size_type lru_cache<Key, T>::size() const {
+  return entries_.size();
+}
+
+template <typename Key, typename T>
+typename lru_cache<Key, T>::size_type lru_cache<Key, T>::cost() const {
+  return cost_;
+}
+
+template <typename Key, typename T>
+typename lru_cache<Key, T>::size_type lru_cache<Key, T>::capacity() const {
+  return capacity_;
+}
+
+template <typename Key, typename T>
+bool lru_cache<Key, T>::empty() const {
+  return entries_.empty();
+}
+
+template <typename Key, typename T>
+bool lru_cache<Key, T>::contains(const key_type &a_key) const {
+  return index_.find(a_key) != index_.end();
+}
+
+template <typename Key, typename T>
+typename lru_cache<Key, T>::mapped_type *lru_cache<Key, T>::find(
+    const key_type &a_key) {
+  auto found = index_.find(a_key);
+  if (found == index_.end()) return nullptr;
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return &found->second->value;
+}
+
+template <typename Key, typename T>
+typename lru_cache<Key, T>::mapped_type *lru_cache<Key, T>::insert(
+    const key_type &a_key, mapped_type a_value, size_type a_cost) {
+  erase(a_key);
+  if (a_cost > capacity_) return nullptr;
+  entries_.push_front(entry{a_key, std::move(a_value), a_cost});
+  index_[a_key] = entries_.begin();
+  cost_ += a_cost;
+  evict();
+  return &entries_.front().value;
+}
+
+template <typename Key, typename T>
+bool lru_cache<Key, T>::erase(const key_type &a_key) {
+  auto found = index_.find(a_key);
+  if (found == index_.end()) return false;
+  cost_ -= found->second->cost;
+  entries_.erase(found->second);
+  index_.erase(found);
+  return true;
+}
+
+template <typename Key, typename T>
+void lru_cache<Key, T>::clear() {
+  entries_.clear();
+  index_.clear();
+  cost_ = 0;
+}
+
+template <typename Key, typename T>
+void lru_cache<Key, T>::set_capacity(size_type a_capacity) {
+  capacity_ = a_capacity;
+  evict();
+}
+
+template <typename Key, typename T>
+void lru_cache<Key, T>::evict() {
+  while (cost_ > capacity_ && !entries_.empty()) {
+    cost_ -= entries_.back().cost;
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace s21
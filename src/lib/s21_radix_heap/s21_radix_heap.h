@@ -0,0 +1,48 @@
+#ifndef S21_RADIX_HEAP_H
+#define S21_RADIX_HEAP_H
+
+#include <bit>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Monotone priority queue for unsigned integer keys. Pushed keys must not be
+// smaller than the last popped one (true for Dijkstra's algorithm). Entry
+// with key k lives in bucket bit_width(k ^ last), so every entry moves to a
+// smaller bucket at most once per key bit - O(log C) amortized per entry.
+template <typename T, typename Key = unsigned>
+class radix_heap {
+ public:
+  using value_type = T;
+  using key_type = Key;
+  using entry_type = std::pair<key_type, value_type>;
+  using const_reference = const entry_type &;
+  using size_type = size_t;
+
+  radix_heap();  // default constructor, creates empty heap
+
+  bool empty() const;
+  size_type size() const;
+
+  void push(key_type a_key, const value_type &a_value);  // a_key >= last
+  const_reference top();  // entry with the smallest key
+  void pop();             // removes top entry
+  void clear();           // removes all entries, resets last key
+
+ private:
+  static constexpr size_type kBuckets = sizeof(key_type) * 8 + 1;
+
+  size_type bucket_of(key_type a_key) const;
+  void refill();  // moves entries with the smallest key to bucket 0
+
+  std::vector<entry_type> buckets_[kBuckets];
+  key_type last_;  // last popped key, lower bound of all keys
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_radix_heap.tpp"
+
+#endif
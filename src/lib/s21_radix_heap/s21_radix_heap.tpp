@@ -0,0 +1,67 @@
+#include "s21_radix_heap.h"
+
+namespace s21 {
+
+template <typename T, typename Key>
+radix_heap<T, Key>::radix_heap() : last_(0), size_(0) {}
+
+template <typename T, typename Key>
+bool radix_heap<T, Key>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Key>
+typename radix_heap<T, Key>::size_type radix_heap<T, Key>::size() const {
+  return size_;
+}
+
+template <typename T, typename Key>
+typename radix_heap<T, Key>::size_type radix_heap<T, Key>::bucket_of(
+    key_type a_key) const {
+  return static_cast<size_type>(std::bit_width(a_key ^ last_));
+}
+
+template <typename T, typename Key>
+void radix_heap<T, Key>::push(key_type a_key, const value_type &a_value) {
+  buckets_[bucket_of(a_key)].emplace_back(a_key, a_value);
+  ++size_;
+}
+
+template <typename T, typename Key>
+void radix_heap<T, Key>::refill() {
+  if (!buckets_[0].empty()) return;
+  size_type index = 1;
+  while (buckets_[index].empty()) ++index;
+  // New last key splits the bucket - all its entries go to lower buckets
+  std::vector<entry_type> &bucket = buckets_[index];
+  last_ = bucket.front().first;
+  for (const entry_type &item : bucket) {
+    if (item.first < last_) last_ = item.first;
+  }
+  for (const entry_type &item : bucket) {
+    buckets_[bucket_of(item.first)].push_back(item);
+  }
+  bucket.clear();
+}
+
+template <typename T, typename Key>
+typename radix_heap<T, Key>::const_reference radix_heap<T, Key>::top() {
+  refill();
+  return buckets_[0].back();
+}
+
+template <typename T, typename Key>
+void radix_heap<T, Key>::pop() {
+  refill();
+  buckets_[0].pop_back();
+  --size_;
+}
+
+template <typename T, typename Key>
+void radix_heap<T, Key>::clear() {
+  for (std::vector<entry_type> &bucket : buckets_) bucket.clear();
+  last_ = 0;
+  size_ = 0;
+}
+
+}  // namespace s21
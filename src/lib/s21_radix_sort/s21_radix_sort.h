@@ -0,0 +1,24 @@
+#ifndef S21_RADIX_SORT_H
+#define S21_RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+#include "../s21_thread_pool/s21_thread_pool.h"
+
+namespace s21 {
+
+// Stable LSD radix sort by an unsigned 32-bit key, one byte per pass. Every
+// worker of the pool counts the digits of its own chunk, the counts give
+// each worker its output ranges, then all chunks are scattered at once.
+// Passes over bytes which are zero in every key are skipped, so small keys
+// take one or two passes. O(n) time, n extra items of memory.
+template <typename T, typename Key>
+void radix_sort(std::vector<T> &a_items, Key a_key,
+                thread_pool &a_pool = thread_pool::shared());
+
+}  // namespace s21
+
+#include "s21_radix_sort.tpp"
+
+#endif
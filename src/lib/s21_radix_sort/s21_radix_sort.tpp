@@ -0,0 +1,53 @@
+#include "s21_radix_sort.h"
+
+#include <algorithm>
+#include <array>
+
+namespace s21 {
+
+template <typename T, typename Key>
+void radix_sort(std::vector<T> &a_items, Key a_key, thread_pool &a_pool) {
+  using size_type = typename std::vector<T>::size_type;
+  using counts_type = std::array<size_type, 256>;
+  const size_type count = a_items.size();
+  if (count < 2) return;
+  uint32_t max_key = 0;
+  for (const T &item : a_items)
+    max_key = std::max<uint32_t>(max_key, a_key(item));
+
+  // Small inputs are not worth waking the workers
+  const size_type chunks =
+      std::min<size_type>(a_pool.size(), (count + 4095) / 4096);
+  const size_type chunk = (count + chunks - 1) / chunks;
+  std::vector<counts_type> counts(chunks);
+  std::vector<T> buffer(count);
+  for (unsigned shift = 0; shift < 32 && (max_key >> shift) != 0;
+       shift += 8) {
+    a_pool.parallel_for(0, chunks, [&](size_type part, size_type) {
+      counts_type &digits = counts[part];
+      digits.fill(0);
+      const size_type end = std::min(count, (part + 1) * chunk);
+      for (size_type i = part * chunk; i < end; ++i)
+        ++digits[(a_key(a_items[i]) >> shift) & 0xFF];
+    });
+    // Digit-major, then chunk-major offsets keep equal keys in order
+    size_type offset = 0;
+    for (size_type digit = 0; digit < 256; ++digit) {
+      for (counts_type &digits : counts) {
+        const size_type digit_count = digits[digit];
+        digits[digit] = offset;
+        offset += digit_count;
+      }
+    }
+    a_pool.parallel_for(0, chunks, [&](size_type part, size_type) {
+      counts_type &offsets = counts[part];
+      const size_type end = std::min(count, (part + 1) * chunk);
+      for (size_type i = part * chunk; i < end; ++i)
+        buffer[offsets[(a_key(a_items[i]) >> shift) & 0xFF]++] =
+            std::move(a_items[i]);
+    });
+    a_items.swap(buffer);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,41 @@
+#ifndef S21_XOSHIRO_H
+#define S21_XOSHIRO_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+
+// xoshiro256++ generator by Blackman and Vigna: 32 bytes of state, a few
+// shifts and adds per number, period 2^256 - 1. Meets the standard
+// UniformRandomBitGenerator requirements, so it works with <random>
+// distributions. jump() skips 2^128 numbers, so copies jumped 0, 1, 2...
+// times give non-overlapping streams, one per thread or task.
+class xoshiro256pp {
+ public:
+  using result_type = uint64_t;
+  using size_type = size_t;
+
+  // state expanded from a_seed by splitmix64, every seed is valid
+  explicit xoshiro256pp(uint64_t a_seed = 0);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  result_type operator()();  // next 64 random bits
+  double uniform();          // uniform double of [0, 1), 53 random bits
+  // a_count uniform doubles of [0, 1), same as a_count uniform() calls
+  void fill_uniform(double *a_out, size_type a_count);
+  void jump();  // skips 2^128 numbers
+
+  bool operator==(const xoshiro256pp &) const = default;
+
+ private:
+  uint64_t state_[4];
+};
+
+}  // namespace s21
+
+#include "s21_xoshiro.tpp"
+
+#endif
@@ -0,0 +1,62 @@
+#include "s21_xoshiro.h"
+
+namespace s21 {
+
+namespace xoshiro_detail {
+
+inline uint64_t rotl(const uint64_t a_value, const int a_shift) {
+  return (a_value << a_shift) | (a_value >> (64 - a_shift));
+}
+
+inline uint64_t splitmix64(uint64_t &a_state) {
+  uint64_t result = (a_state += 0x9e3779b97f4a7c15ULL);
+  result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  result = (result ^ (result >> 27)) * 0x94d049bb133111ebULL;
+  return result ^ (result >> 31);
+}
+
+}  // namespace xoshiro_detail
+
+inline xoshiro256pp::xoshiro256pp(uint64_t a_seed) {
+  // splitmix64 never gives four zero words in a row
+  for (uint64_t &word : state_) word = xoshiro_detail::splitmix64(a_seed);
+}
+
+inline typename xoshiro256pp::result_type xoshiro256pp::operator()() {
+  const uint64_t result =
+      xoshiro_detail::rotl(state_[0] + state_[3], 23) + state_[0];
+  const uint64_t shifted = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= shifted;
+  state_[3] = xoshiro_detail::rotl(state_[3], 45);
+  return result;
+}
+
+inline double xoshiro256pp::uniform() {
+  return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+}
+
+inline void xoshiro256pp::fill_uniform(double *a_out, size_type a_count) {
+  for (size_type i = 0; i < a_count; ++i) a_out[i] = uniform();
+}
+
+inline void xoshiro256pp::jump() {
+  static const uint64_t kJump[] = {
+      0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL,
+      0x39abdc4529b1661cULL};
+  uint64_t jumped[4] = {0, 0, 0, 0};
+  for (const uint64_t mask : kJump) {
+    for (int bit = 0; bit < 64; ++bit) {
+      if (mask & (uint64_t{1} << bit)) {
+        for (int word = 0; word < 4; ++word) jumped[word] ^= state_[word];
+      }
+      (*this)();
+    }
+  }
+  for (int word = 0; word < 4; ++word) state_[word] = jumped[word];
+}
+
+}  // namespace s21
@@ -0,0 +1,57 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Persistent workers for data-parallel loops. The calling thread takes part
+// in every loop, so a pool of size 1 has no threads and runs loops inline.
+class thread_pool {
+ public:
+  using size_type = size_t;
+
+  // creates pool of a_size workers (caller included), 0 - hardware threads
+  explicit thread_pool(size_type a_size = 0);
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();  // joins workers
+
+  size_type size() const;  // number of workers, caller included
+
+  // calls a_function(index, worker) for every index of [a_begin, a_end),
+  // split into one static chunk per worker; returns when all chunks are
+  // done and rethrows the first exception. Nested or concurrent loops run
+  // inline on the calling thread
+  template <typename Function>
+  void parallel_for(size_type a_begin, size_type a_end, Function &&a_function);
+
+  static thread_pool &shared();  // process wide pool of hardware size
+
+ private:
+  void worker_loop(size_type a_worker);
+  void run_chunk(size_type a_worker);
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  std::function<void(size_type)> task_;  // runs chunk of worker
+  std::exception_ptr error_;
+  size_type generation_;  // number of started loops
+  size_type pending_;     // threads still running current loop
+  bool stop_;
+  std::atomic<bool> busy_;
+};
+
+}  // namespace s21
+
+#include "s21_thread_pool.tpp"
+
+#endif
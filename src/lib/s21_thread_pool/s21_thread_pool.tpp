@@ -0,0 +1,97 @@
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+inline thread_pool::thread_pool(size_type a_size)
+    : generation_(0), pending_(0), stop_(false), busy_(false) {
+  if (a_size == 0) a_size = std::thread::hardware_concurrency();
+  if (a_size == 0) a_size = 1;
+  for (size_type worker = 1; worker < a_size; ++worker) {
+    threads_.emplace_back(&thread_pool::worker_loop, this, worker);
+  }
+}
+
+inline thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (std::thread &thread : threads_) thread.join();
+}
+
+inline typename thread_pool::size_type thread_pool::size() const {
+  return threads_.size() + 1;
+}
+
+inline thread_pool &thread_pool::shared() {
+  static thread_pool pool;
+  return pool;
+}
+
+template <typename Function>
+void thread_pool::parallel_for(size_type a_begin, size_type a_end,
+                               Function &&a_function) {
+  if (a_begin >= a_end) return;
+  const size_type count = a_end - a_begin;
+  bool expected = false;
+  if (threads_.empty() || count == 1 ||
+      !busy_.compare_exchange_strong(expected, true)) {
+    for (size_type index = a_begin; index < a_end; ++index)
+      a_function(index, 0);
+    return;
+  }
+
+  const size_type workers = size();
+  task_ = [&](size_type a_worker) {
+    const size_type first = a_begin + count * a_worker / workers;
+    const size_type last = a_begin + count * (a_worker + 1) / workers;
+    for (size_type index = first; index < last; ++index)
+      a_function(index, a_worker);
+  };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    error_ = nullptr;
+    pending_ = threads_.size();
+    ++generation_;
+  }
+  start_.notify_all();
+  run_chunk(0);
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return pending_ == 0; });
+  task_ = nullptr;
+  std::exception_ptr error = error_;
+  lock.unlock();
+  busy_ = false;
+  if (error) std::rethrow_exception(error);
+}
+
+inline void thread_pool::run_chunk(size_type a_worker) {
+  try {
+    task_(a_worker);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!error_) error_ = std::current_exception();
+  }
+}
+
+inline void thread_pool::worker_loop(size_type a_worker) {
+  size_type seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock,
+                  [&] { return stop_ || generation_ != seen_generation; });
+      if (stop_) return;
+      seen_generation = generation_;
+    }
+    run_chunk(a_worker);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --pending_;
+    }
+    done_.notify_one();
+  }
+}
+
+}  // namespace s21
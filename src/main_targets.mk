@@ -24,7 +24,7 @@ all: build
 .PHONY: run
 run:
 	@echo "$(GREEN)Compiling and running...$(RESET)"
-	@$(CC) $(CFLAGS) $(MAIN_CPP) view/cli.cpp -L$(EXE_DIR) -l:$(LIB_NAME_GRAPH) -l:$(LIB_NAME_ALGORITHMS) -o $(EXE)
+	@$(CC) $(CFLAGS) $(MAIN_CPP) view/cli.cpp -L$(EXE_DIR) -l:$(LIB_NAME_GRAPH) -l:$(LIB_NAME_ALGORITHMS) -pthread -o $(EXE)
 	@$(EXE_DIR)$(EXE)
 
 #### <<BUILD>> ####
@@ -74,11 +74,11 @@ test_graph: $(TEST_GRAPH_O) $(LIB_NAME_GRAPH)
 	@./$(FILE_NAME_TEST_GRAPH) || exit 1
 
 .PHONY: test_algorithms
-test_algorithms: $(TEST_ALGORITHMS_O) $(LIB_NAME_ALGORITHMS)
+test_algorithms: $(TEST_ALGORITHMS_O) $(LIB_NAME_ALGORITHMS) $(LIB_NAME_GRAPH)
 	@echo "$(GREEN)Start testing graph algorithms$(RESET)"
 	@rm -f $(FILE_NAME_TEST_ALGORITHMS)
 	@$(CC) $(CFLAGS) $(TEST_ALGORITHMS_O) -DTEST -o $(FILE_NAME_TEST_ALGORITHMS) \
-	 -L. -l:$(LIB_NAME_ALGORITHMS) $(LFLAGS) $(DEBUG_FLAG)
+	 -L. -l:$(LIB_NAME_ALGORITHMS) -l:$(LIB_NAME_GRAPH) $(LFLAGS) $(DEBUG_FLAG)
 	@./$(FILE_NAME_TEST_ALGORITHMS) || exit 1
 #### >>TESTING<< ####
 
@@ -184,6 +184,7 @@ PHONY: gcov_algorithms
 gcov_algorithms:
 	@echo "$(GREEN)Start making gcov report - graph_algorithms lib$(RESET)"
 	@$(CC) $(CFLAGS) $(GFLAGS) -c $(LIB_ALGORITHMS_SRC)
+	@$(CC) $(CFLAGS) -c $(LIB_GRAPH_SRC)
 	@$(CC) $(CFLAGS) $(GFLAGS) -c $(TEST_ALGORITHMS_SRC)
 	@$(CC) *.o -o $(FILE_NAME_TEST_ALGORITHMS) $(LFLAGS) $(GFLAGS)
 	@./$(FILE_NAME_TEST_ALGORITHMS)
@@ -5,9 +5,80 @@
 
 #include <filesystem>
 #include <fstream>
+#include <random>
+#include <set>
 #include <sstream>
 
 #include "../lib/s21_graph/s21_graph.h"
 #include "../lib/s21_graph_algorithms/s21_graph_algorithms.h"
 
+/**
+ * @brief Builds a valid random graph for comparing implementations
+ * @param a_size Number of vertices
+ * @param a_density Probability of every edge
+ * @param a_max_weight Weights are taken from 1 to a_max_weight
+ * @param a_seed Seed of the generator
+ * @param a_symmetric Mirror every edge if true
+ * @return Random graph
+ */
+inline Graph make_random_graph(size_t a_size, double a_density,
+                               int a_max_weight, unsigned a_seed,
+                               bool a_symmetric = true) {
+  std::mt19937 gen(a_seed);
+  std::bernoulli_distribution has_edge(a_density);
+  std::uniform_int_distribution<int> weight(1, a_max_weight);
+  Graph graph(a_size);
+  graph.valid_graph_ = true;
+  for (size_t i = 0; i < a_size; ++i) {
+    for (size_t j = a_symmetric ? i + 1 : 0; j < a_size; ++j) {
+      if (i == j || !has_edge(gen)) continue;
+      graph[i][j] = weight(gen);
+      if (a_symmetric) graph[j][i] = graph[i][j];
+    }
+  }
+  return graph;
+}
+
+/**
+ * @brief Sums weights of the edges of a route
+ * @param a_graph Input graph
+ * @param a_route Route vertices (numeration from 1)
+ * @return Route length
+ */
+inline Alias::distance route_length(const Graph& a_graph,
+                                    const Alias::IntRow& a_route) {
+  Alias::distance result = 0;
+  for (size_t i = 1; i < a_route.size(); ++i)
+    result += a_graph[a_route[i - 1] - 1][a_route[i] - 1];
+  return result;
+}
+
+/**
+ * @brief Compares routes of a point-to-point engine with Dijkstra's trees
+ * @tparam Engine Class with RouteResult FindRoute(int, int)
+ * @param a_graph Graph the engine was built for
+ * @param a_engine Engine under test
+ * @param a_to_step Step between checked targets, sources step by 3
+ */
+template <typename Engine>
+void expect_same_routes(const Graph& a_graph, Engine& a_engine,
+                        const int a_to_step = 1) {
+  const int size = static_cast<int>(a_graph.get_graph_size());
+  for (int from = 1; from <= size; from += 3) {
+    ShortPath tree = GraphAlgorithms::GetShortPath(a_graph, from - 1);
+    for (int to = 1; to <= size; to += a_to_step) {
+      RouteResult route = a_engine.FindRoute(from, to);
+      EXPECT_EQ(route.distance, tree.distances[to - 1]);
+      if (route.distance == UINT_MAX) {
+        EXPECT_TRUE(route.vertices.empty());
+        continue;
+      }
+      ASSERT_FALSE(route.vertices.empty());
+      EXPECT_EQ(route.vertices.front(), from);
+      EXPECT_EQ(route.vertices.back(), to);
+      EXPECT_EQ(route_length(a_graph, route.vertices), route.distance);
+    }
+  }
+}
+
 #endif
\ No newline at end of file
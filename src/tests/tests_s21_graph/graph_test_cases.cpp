@@ -238,4 +238,63 @@ TEST(GraphEdgeCaseTest, OutOfBoundsAccess) {
 TEST(GraphCoverageTest, DestructorCoverage) {
   auto* g = new Graph(2);
   delete g;
-}
\ No newline at end of file
+}
+TEST(GraphRevisionTest, ChangesOnModification) {
+  Graph graph(3);
+  Graph other(3);
+  EXPECT_NE(graph.get_revision(), other.get_revision());
+
+  const unsigned long long revision = graph.get_revision();
+  const Graph& const_graph = graph;
+  EXPECT_EQ(const_graph[1][2], 0);
+  EXPECT_EQ(graph.get_revision(), revision);
+  graph[1][2] = 5;
+  EXPECT_NE(graph.get_revision(), revision);
+
+  Graph copy = graph;
+  EXPECT_EQ(copy.get_revision(), graph.get_revision());
+  copy[0][1] = 1;
+  EXPECT_NE(copy.get_revision(), graph.get_revision());
+}
+
+TEST(GraphModificationTest, SetEdgeWeight) {
+  Graph graph(3);
+  const unsigned long long revision = graph.get_revision();
+  EXPECT_EQ(graph.set_edge_weight(0, 2, 7), 0);
+  EXPECT_EQ(graph.set_edge_weight(0, 2, 4), 7);
+  EXPECT_EQ(graph[0][2], 4);
+  EXPECT_EQ(graph[2][0], 0);
+  EXPECT_NE(graph.get_revision(), revision);
+  EXPECT_THROW(graph.set_edge_weight(3, 0, 1), std::invalid_argument);
+  EXPECT_THROW(graph.set_edge_weight(0, 1, -1), std::invalid_argument);
+}
+
+TEST(GraphFingerprintTest, DependsOnContents) {
+  Graph graph(5);
+  for (size_t i = 0; i < 5; ++i) graph[i][(i + 1) % 5] = int(i) + 1;
+  Graph copy = graph;
+  EXPECT_EQ(graph.get_fingerprint(), copy.get_fingerprint());
+  EXPECT_EQ(graph.get_fingerprint().ToHex().size(), 32u);
+  copy.set_edge_weight(0, 1, 1);
+  EXPECT_EQ(graph.get_fingerprint(), copy.get_fingerprint());
+  copy.set_edge_weight(0, 1, 2);
+  EXPECT_NE(graph.get_fingerprint(), copy.get_fingerprint());
+  EXPECT_NE(Graph(4).get_fingerprint(), Graph(5).get_fingerprint());
+}
+
+TEST(GraphFingerprintTest, IndependentOfSplit) {
+  std::vector<int> cells(37);
+  for (size_t i = 0; i < cells.size(); ++i) cells[i] = int(i * i) - 100;
+  FingerprintHasher whole;
+  whole.Update(cells.data(), cells.size());
+  FingerprintHasher parts;
+  parts.Update(cells.data(), 3);
+  parts.Update(cells.data() + 3, 0);
+  parts.Update(cells.data() + 3, 20);
+  parts.Update(cells.data() + 23, 14);
+  EXPECT_EQ(whole.Finish(), parts.Finish());
+  cells[36]++;
+  FingerprintHasher changed;
+  changed.Update(cells.data(), cells.size());
+  EXPECT_NE(whole.Finish(), changed.Finish());
+}
@@ -62,10 +62,9 @@ TEST(GetSpanTreeTest, Test1) {
   SpanTree result = GraphAlgorithms::GetSpanTree(graph);
 
   EXPECT_EQ(result.tree_weight, 13);
-  EXPECT_EQ(result.Tree[0][1], 1);
-  EXPECT_EQ(result.Tree[0][2], 2);
-  EXPECT_EQ(result.Tree[1][3], 4);
-  EXPECT_EQ(result.Tree[2][4], 6);
+  std::vector<TreeEdge> edges = {{0, 1, 1}, {0, 2, 2}, {1, 3, 4}, {2, 4, 6}};
+  EXPECT_EQ(result.edges, edges);
+  EXPECT_EQ(result.parents, Alias::IntRow({-1, 0, 0, 1, 2}));
 }
 
 TEST(GetSpanTreeTest, Test2) {
@@ -80,9 +79,9 @@ TEST(GetSpanTreeTest, Test2) {
   SpanTree result = GraphAlgorithms::GetSpanTree(graph);
 
   EXPECT_EQ(result.tree_weight, 7);
-  EXPECT_EQ(result.Tree[0][1], 1);
-  EXPECT_EQ(result.Tree[0][2], 2);
-  EXPECT_EQ(result.Tree[1][3], 4);
+  std::vector<TreeEdge> edges = {{0, 1, 1}, {0, 2, 2}, {1, 3, 4}};
+  EXPECT_EQ(result.edges, edges);
+  EXPECT_EQ(result.parents, Alias::IntRow({-1, 0, 0, 1}));
 }
 
 TEST(GetSpanTreeTest, Test3) {
@@ -95,6 +94,8 @@ TEST(GetSpanTreeTest, Test3) {
   SpanTree result = GraphAlgorithms::GetSpanTree(graph);
 
   EXPECT_EQ(result.tree_weight, 3);
-  EXPECT_EQ(result.Tree[0][1], 1);
-  EXPECT_EQ(result.Tree[0][2], 2);
+  std::vector<TreeEdge> edges = {{0, 1, 1}, {0, 2, 2}};
+  EXPECT_EQ(result.edges, edges);
+  Alias::IntGrid matrix = {{0, 1, 2}, {1, 0, 0}, {2, 0, 0}};
+  EXPECT_EQ(result.ToMatrix(), matrix);
 }
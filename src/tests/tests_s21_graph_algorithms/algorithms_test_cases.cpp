@@ -305,9 +305,18 @@ TEST_F(GraphAlgorithmsTest, GetSpanTreeThrowsOnInvalidGraph) {
 
 TEST_F(GraphAlgorithmsTest, GetSpanTreeSimpleGraph) {
   simple_graph.valid_graph_ = true;
-  auto [matrix, weight] = GraphAlgorithms::GetSpanTree(simple_graph);
+  SpanTree tree = GraphAlgorithms::GetSpanTree(simple_graph);
+
+  EXPECT_EQ(tree.tree_weight, 4);
+  std::vector<TreeEdge> edges = {{0, 1, 1}, {1, 2, 3}};
+  EXPECT_EQ(tree.edges, edges);
+  EXPECT_EQ(tree.parents, Alias::IntRow({-1, 0, 1}));
+}
+
+TEST_F(GraphAlgorithmsTest, GetLeastSpanningTreeSimpleGraph) {
+  simple_graph.valid_graph_ = true;
+  Alias::IntGrid matrix = GraphAlgorithms::GetLeastSpanningTree(simple_graph);
 
-  EXPECT_EQ(weight, 4);
   EXPECT_EQ(matrix[0][1], 1);
   EXPECT_EQ(matrix[1][0], 2);
   EXPECT_EQ(matrix[1][2], 3);
@@ -318,10 +327,13 @@ TEST_F(GraphAlgorithmsTest, GetSpanTreeSimpleGraph) {
 
 TEST_F(GraphAlgorithmsTest, GetSpanTreeWeightedGraph) {
   weighted_graph.valid_graph_ = true;
-  auto [matrix, weight] = GraphAlgorithms::GetSpanTree(weighted_graph);
+  SpanTree tree = GraphAlgorithms::GetSpanTree(weighted_graph);
 
-  EXPECT_EQ(weight, 10);
+  EXPECT_EQ(tree.tree_weight, 10);
+  std::vector<TreeEdge> edges = {{0, 1, 5}, {1, 2, 3}, {2, 3, 2}};
+  EXPECT_EQ(tree.edges, edges);
 
+  Alias::IntGrid matrix = tree.ToMatrix();
   EXPECT_EQ(matrix[0][1], 5);
   EXPECT_EQ(matrix[1][0], 5);
   EXPECT_EQ(matrix[1][2], 3);
@@ -354,25 +366,19 @@ TEST_F(GraphAlgorithmsTest, GetSpanTreeWeightValidGraph2) {
 
 TEST_F(GraphAlgorithmsTest, GetSpanTreeGraphWithLoop) {
   graph_with_loop.valid_graph_ = true;
-  auto [matrix, weight] = GraphAlgorithms::GetSpanTree(graph_with_loop);
+  SpanTree tree = GraphAlgorithms::GetSpanTree(graph_with_loop);
 
-  EXPECT_EQ(weight, 1);
-  EXPECT_EQ(matrix[0][1], 1);
-  EXPECT_EQ(matrix[1][0], 1);
+  EXPECT_EQ(tree.tree_weight, 1);
+  std::vector<TreeEdge> edges = {{0, 1, 1}};
+  EXPECT_EQ(tree.edges, edges);
 }
 
 TEST_F(GraphAlgorithmsTest, GetSpanTreeGraph3) {
   graph3_.valid_graph_ = true;
-  auto [matrix, weight] = GraphAlgorithms::GetSpanTree(graph3_);
-
-  EXPECT_EQ(weight, 2);
-  int edge_count = 0;
-  for (const auto& row : matrix) {
-    for (int val : row) {
-      if (val > 0) edge_count++;
-    }
-  }
-  EXPECT_EQ(edge_count, 4);
+  SpanTree tree = GraphAlgorithms::GetSpanTree(graph3_);
+
+  EXPECT_EQ(tree.tree_weight, 2);
+  EXPECT_EQ(tree.edges.size(), 2);
 }
 
 TEST_F(GraphAlgorithmsTest, ThrowsOnEmptyGraph) {
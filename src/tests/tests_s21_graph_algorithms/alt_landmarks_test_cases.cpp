@@ -0,0 +1,75 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_alt_landmarks.h"
+
+TEST(AltLandmarksTest, MatchesDijkstra) {
+  unsigned seed = 300;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.03, 0.1, 0.6}) {
+      Graph graph = make_random_graph(50, density, 30, seed++, symmetric);
+      for (LandmarkSelection selection :
+           {LandmarkSelection::kFarthest, LandmarkSelection::kAvoid}) {
+        AltLandmarks alt(graph, 4, selection);
+        EXPECT_EQ(alt.get_landmarks().size(), 4u);
+        expect_same_routes(graph, alt, 4);
+      }
+    }
+  }
+}
+
+TEST(AltLandmarksTest, LowerBoundIsValid) {
+  Graph graph = make_random_graph(40, 0.1, 25, 310, false);
+  AltLandmarks alt(graph, 6);
+  for (size_t from = 0; from < 40; ++from) {
+    ShortPath tree = GraphAlgorithms::GetShortPath(graph, from);
+    for (size_t to = 0; to < 40; ++to) {
+      if (tree.distances[to] == UINT_MAX) continue;
+      EXPECT_LE(alt.lower_bound(from, to), tree.distances[to]);
+    }
+  }
+}
+
+TEST(AltLandmarksTest, LandmarksAreDistinct) {
+  Graph graph = make_random_graph(30, 0.2, 10, 320);
+  AltLandmarks alt(graph, 100);
+  std::vector<Alias::node_index> landmarks = alt.get_landmarks();
+  EXPECT_EQ(landmarks.size(), 30u);
+  std::sort(landmarks.begin(), landmarks.end());
+  EXPECT_EQ(std::unique(landmarks.begin(), landmarks.end()), landmarks.end());
+}
+
+TEST(AltLandmarksTest, SaveAndLoad) {
+  const std::string filename = "alt_test_graph.txt.alt";
+  Graph graph = make_random_graph(35, 0.1, 20, 330, false);
+  AltLandmarks alt(graph, 3);
+  alt.SaveToFile(filename);
+  AltLandmarks loaded = AltLandmarks::LoadFromFile(graph, filename);
+  EXPECT_EQ(loaded.get_landmarks(), alt.get_landmarks());
+  EXPECT_EQ(loaded.from_landmark_, alt.from_landmark_);
+  EXPECT_EQ(loaded.to_landmark_, alt.to_landmark_);
+  expect_same_routes(graph, loaded, 4);
+
+  Graph other = make_random_graph(20, 0.1, 20, 331, false);
+  EXPECT_THROW(AltLandmarks::LoadFromFile(other, filename),
+               std::invalid_argument);
+  // Same size and directedness, another weight
+  Graph changed = graph;
+  size_t to = 1;
+  while (changed[0][to] == 0) ++to;
+  changed.set_edge_weight(0, to, changed[0][to] + 1);
+  EXPECT_THROW(AltLandmarks::LoadFromFile(changed, filename),
+               std::invalid_argument);
+  std::filesystem::remove(filename);
+  EXPECT_THROW(AltLandmarks::LoadFromFile(graph, filename),
+               std::invalid_argument);
+}
+
+TEST(AltLandmarksTest, InvalidVertices) {
+  Graph graph = make_random_graph(10, 0.3, 10, 340);
+  AltLandmarks alt(graph, 2);
+  EXPECT_THROW(alt.FindRoute(0, 3), std::invalid_argument);
+  EXPECT_THROW(alt.FindRoute(3, 11), std::invalid_argument);
+  RouteResult route = alt.FindRoute(4, 4);
+  EXPECT_EQ(route.distance, 0u);
+  EXPECT_EQ(route.vertices, Alias::IntRow({4}));
+}
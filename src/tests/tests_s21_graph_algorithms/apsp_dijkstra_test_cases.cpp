@@ -0,0 +1,49 @@
+#include "../s21_graph_tests.h"
+
+TEST(ApspDijkstraTest, MatchesFloyd) {
+  unsigned seed = 1000;
+  for (bool symmetric : {true, false}) {
+    for (size_t size : {1, 9, 70, 150}) {
+      for (double density : {0.01, 0.05, 0.4}) {
+        Graph graph = make_random_graph(size, density, 60, seed++, symmetric);
+        const Alias::IntGrid expected =
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+        EXPECT_EQ(GraphAlgorithms::GetShortestPathsDijkstra(graph), expected);
+        for (ApspStrategy strategy :
+             {ApspStrategy::kAuto, ApspStrategy::kFloydWarshall,
+              ApspStrategy::kDijkstra}) {
+          EXPECT_EQ(GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+                        graph, ApspOptions{2, strategy}),
+                    expected);
+        }
+      }
+    }
+  }
+}
+
+TEST(ApspDijkstraTest, NegativeWeights) {
+  // Edges only go to larger indexes, so negative weights make no cycles
+  Graph graph = make_random_graph(60, 0.1, 30, 1010, false);
+  std::mt19937 random(1011);
+  for (size_t i = 0; i < 60; ++i) {
+    for (size_t j = 0; j <= i; ++j) graph[i][j] = 0;
+    for (size_t j = i + 1; j < 60; ++j) {
+      if (graph[i][j] != 0 && random() % 3 == 0) graph[i][j] -= 20;
+    }
+  }
+  EXPECT_EQ(GraphAlgorithms::GetShortestPathsDijkstra(graph),
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+  // A negative cycle falls back to Floyd-Warshall
+  graph[59][0] = -1000;
+  EXPECT_EQ(GraphAlgorithms::GetShortestPathsDijkstra(graph),
+            GraphAlgorithms::GetShortestPathsFloydBlocked(graph));
+}
+
+TEST(ApspDijkstraTest, PicksStrategyByDensity) {
+  Graph sparse = make_random_graph(2000, 0.0005, 10, 1020, false);
+  EXPECT_EQ(GraphAlgorithms::pick_apsp_strategy(sparse),
+            ApspStrategy::kDijkstra);
+  Graph dense = make_random_graph(300, 0.3, 10, 1021);
+  EXPECT_EQ(GraphAlgorithms::pick_apsp_strategy(dense),
+            ApspStrategy::kFloydWarshall);
+}
@@ -0,0 +1,57 @@
+#include "../s21_graph_tests.h"
+
+TEST(ConcurrentDisjointSetTest, UniteFromManyThreads) {
+  const size_t size = 20000;
+  s21::concurrent_disjoint_set sets(size);
+  std::atomic<size_t> joined{0};
+  s21::thread_pool pool(4);
+  // Chain i - i + 1 and a second chain over even elements, joined twice
+  pool.parallel_for(0, size - 1, [&](size_t i, size_t) {
+    joined += sets.unite(i, i + 1);
+    if (i % 2 == 0 && i + 2 < size) joined += sets.unite(i + 2, i);
+  });
+  EXPECT_EQ(joined.load(), size - 1);
+  EXPECT_TRUE(sets.same(0, size - 1));
+  EXPECT_EQ(sets.find(size - 1), 0u);
+  EXPECT_FALSE(sets.unite(5, 17));
+  s21::concurrent_disjoint_set alone(3);
+  EXPECT_FALSE(alone.same(0, 2));
+  EXPECT_EQ(alone.size(), 3u);
+}
+
+TEST(BoruvkaTest, SameWeightAsPrim) {
+  unsigned seed = 1400;
+  for (size_t size : {1, 2, 40, 300}) {
+    for (double density : {0.005, 0.05, 0.4}) {
+      for (int max_weight : {2, 1000}) {
+        Graph graph = make_random_graph(size, density, max_weight, seed++);
+        const SpanTree prim = GraphAlgorithms::GetSpanTreeHeap(graph);
+        MstStats stats;
+        const SpanTree single = GraphAlgorithms::GetSpanTreeBoruvka(graph, 1);
+        const SpanTree parallel =
+            GraphAlgorithms::GetSpanTreeBoruvka(graph, 3, &stats);
+        EXPECT_EQ(single.tree_weight, prim.tree_weight);
+        EXPECT_EQ(parallel.edges, single.edges);
+        const SpanTree sparse = GraphAlgorithms::GetSpanTreeBoruvka(
+            CsrGraph::FromGraph(graph), 2);
+        EXPECT_EQ(sparse.edges, single.edges);
+        EXPECT_EQ(GraphAlgorithms::GetSpanTree(graph, MstStrategy::kBoruvka)
+                      .tree_weight,
+                  prim.tree_weight);
+        // Every round at least halves the number of components
+        EXPECT_LE(stats.rounds, size > 1 ? std::log2(size) + 1 : 0);
+        EXPECT_LT(stats.tree_edges, std::max<size_t>(size, 1));
+      }
+    }
+  }
+}
+
+TEST(BoruvkaTest, Errors) {
+  Graph directed = make_random_graph(30, 0.2, 20, 1410, false);
+  EXPECT_THROW(GraphAlgorithms::GetSpanTreeBoruvka(directed),
+               std::invalid_argument);
+  EXPECT_THROW(GraphAlgorithms::GetSpanTreeBoruvka(Graph(3)),
+               std::invalid_argument);
+  EXPECT_THROW(GraphAlgorithms::GetSpanTreeBoruvka(CsrGraph()),
+               std::invalid_argument);
+}
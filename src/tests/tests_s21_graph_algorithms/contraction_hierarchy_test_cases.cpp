@@ -0,0 +1,67 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_contraction_hierarchy.h"
+
+TEST(ContractionHierarchyTest, MatchesDijkstra) {
+  unsigned seed = 400;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.02, 0.05, 0.15}) {
+      Graph graph = make_random_graph(60, density, 30, seed++, symmetric);
+      ContractionHierarchy hierarchy(graph);
+      EXPECT_EQ(hierarchy.get_vertices_count(), 60u);
+      expect_same_routes(graph, hierarchy);
+    }
+  }
+}
+
+TEST(ContractionHierarchyTest, RanksArePermutation) {
+  Graph graph = make_random_graph(40, 0.1, 10, 410);
+  ContractionHierarchy hierarchy(graph);
+  std::vector<size_t> ranks = hierarchy.ranks_;
+  std::sort(ranks.begin(), ranks.end());
+  for (size_t i = 0; i < ranks.size(); ++i) EXPECT_EQ(ranks[i], i);
+  for (size_t v = 0; v < 40; ++v) {
+    for (size_t i = hierarchy.up_.offsets[v]; i < hierarchy.up_.offsets[v + 1];
+         ++i)
+      EXPECT_GT(hierarchy.ranks_[hierarchy.up_.arcs[i].target],
+                hierarchy.ranks_[v]);
+  }
+}
+
+TEST(ContractionHierarchyTest, SaveAndLoad) {
+  const std::string filename = "ch_test_graph.txt.ch";
+  Graph graph = make_random_graph(45, 0.08, 20, 420, false);
+  ContractionHierarchy hierarchy(graph);
+  hierarchy.SaveToFile(filename);
+  ContractionHierarchy loaded = ContractionHierarchy::LoadFromFile(filename);
+  EXPECT_EQ(loaded.ranks_, hierarchy.ranks_);
+  EXPECT_EQ(loaded.get_shortcuts_count(), hierarchy.get_shortcuts_count());
+  expect_same_routes(graph, loaded);
+
+  // Shortcut whose middle vertex has no arcs to unpack it with
+  auto shortcut = std::find_if(
+      hierarchy.up_.arcs.begin(), hierarchy.up_.arcs.end(),
+      [](const ContractionHierarchy::Arc& arc) { return arc.middle != -1; });
+  ASSERT_NE(shortcut, hierarchy.up_.arcs.end());
+  shortcut->middle = static_cast<int>(shortcut->target);
+  hierarchy.SaveToFile(filename);
+  EXPECT_THROW(ContractionHierarchy::LoadFromFile(filename),
+               std::invalid_argument);
+
+  std::ofstream(filename) << "CH 3 1";
+  EXPECT_THROW(ContractionHierarchy::LoadFromFile(filename),
+               std::invalid_argument);
+  std::filesystem::remove(filename);
+  EXPECT_THROW(ContractionHierarchy::LoadFromFile(filename),
+               std::invalid_argument);
+}
+
+TEST(ContractionHierarchyTest, InvalidVertices) {
+  Graph graph = make_random_graph(10, 0.3, 10, 430);
+  ContractionHierarchy hierarchy(graph);
+  EXPECT_THROW(hierarchy.FindRoute(0, 3), std::invalid_argument);
+  EXPECT_THROW(hierarchy.FindRoute(3, 11), std::invalid_argument);
+  RouteResult route = hierarchy.FindRoute(4, 4);
+  EXPECT_EQ(route.distance, 0u);
+  EXPECT_EQ(route.vertices, Alias::IntRow({4}));
+}
@@ -0,0 +1,75 @@
+#include "../s21_graph_tests.h"
+
+TEST(ThreadPoolTest, VisitsEveryIndexOnce) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4u);
+  for (size_t count : {0, 1, 3, 4, 17, 1000}) {
+    std::vector<int> visits(count, 0);
+    std::vector<size_t> workers(count, 0);
+    pool.parallel_for(0, count, [&](size_t index, size_t worker) {
+      visits[index]++;
+      workers[index] = worker;
+    });
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(visits[i], 1);
+      EXPECT_LT(workers[i], pool.size());
+    }
+  }
+}
+
+TEST(ThreadPoolTest, NestedLoopsAndExceptions) {
+  s21::thread_pool pool(3);
+  std::vector<int> sums(6, 0);
+  pool.parallel_for(0, 6, [&](size_t outer, size_t) {
+    pool.parallel_for(0, 10, [&](size_t inner, size_t) {
+      sums[outer] += static_cast<int>(inner);
+    });
+  });
+  for (int sum : sums) EXPECT_EQ(sum, 45);
+  EXPECT_THROW(pool.parallel_for(0, 9,
+                                 [](size_t index, size_t) {
+                                   if (index == 7)
+                                     throw std::invalid_argument("index");
+                                 }),
+               std::invalid_argument);
+  int count = 0;
+  s21::thread_pool single(1);
+  single.parallel_for(2, 5, [&](size_t, size_t worker) {
+    count++;
+    EXPECT_EQ(worker, 0u);
+  });
+  EXPECT_EQ(count, 3);
+}
+
+TEST(DeltaSteppingTest, MatchesDijkstra) {
+  unsigned seed = 500;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.02, 0.1, 0.5}) {
+      for (int max_weight : {1, 7, 1000}) {
+        Graph graph =
+            make_random_graph(70, density, max_weight, seed++, symmetric);
+        for (int start : {0, 33, 69}) {
+          ShortPath expected = GraphAlgorithms::GetShortPathHeap(graph, start);
+          for (Alias::distance delta : {0u, 1u, 5u, 100000u}) {
+            ShortPath result =
+                GraphAlgorithms::GetShortPathDeltaStepping(graph, start, delta);
+            EXPECT_EQ(result.distances, expected.distances);
+            EXPECT_EQ(result.prev_nodes, expected.prev_nodes);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(DeltaSteppingTest, InvalidStart) {
+  Graph graph = make_random_graph(5, 0.5, 3, 510);
+  EXPECT_TRUE(GraphAlgorithms::GetShortPathDeltaStepping(graph, -1)
+                  .distances.empty());
+  EXPECT_TRUE(
+      GraphAlgorithms::GetShortPathDeltaStepping(graph, 5).distances.empty());
+  Graph single(1);
+  ShortPath result = GraphAlgorithms::GetShortPathDeltaStepping(single, 0);
+  EXPECT_EQ(result.distances, std::vector<Alias::distance>({0}));
+  EXPECT_EQ(result.prev_nodes, std::vector<int>({-1}));
+}
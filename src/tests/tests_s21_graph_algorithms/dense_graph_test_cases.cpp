@@ -0,0 +1,81 @@
+#include "../s21_graph_tests.h"
+
+class DenseGraphTest : public ::testing::TestWithParam<Simd::Level> {
+ protected:
+  void SetUp() override { Simd::set_level(GetParam()); }
+  void TearDown() override { Simd::set_level(Simd::detected_level()); }
+};
+
+TEST_P(DenseGraphTest, ShortPathMatchesHeap) {
+  unsigned seed = 1;
+  for (size_t size : {2, 7, 16, 33, 100}) {
+    for (double density : {0.05, 0.3, 1.0}) {
+      Graph graph = make_random_graph(size, density, 50, seed++, false);
+      for (int start = 0; start < static_cast<int>(size); start += 3) {
+        ShortPath heap = GraphAlgorithms::GetShortPathHeap(graph, start);
+        ShortPath dense = GraphAlgorithms::GetShortPathDense(graph, start);
+        EXPECT_EQ(dense.distances, heap.distances);
+        EXPECT_EQ(dense.prev_nodes, heap.prev_nodes);
+      }
+    }
+  }
+}
+
+TEST_P(DenseGraphTest, ShortPathTiesMatchHeap) {
+  Graph graph = make_random_graph(40, 0.8, 2, 7);
+  for (int start = 0; start < 40; ++start) {
+    ShortPath heap = GraphAlgorithms::GetShortPathHeap(graph, start);
+    ShortPath dense = GraphAlgorithms::GetShortPathDense(graph, start);
+    EXPECT_EQ(dense.prev_nodes, heap.prev_nodes);
+  }
+}
+
+TEST_P(DenseGraphTest, SpanTreeMatchesHeap) {
+  unsigned seed = 100;
+  for (size_t size : {2, 9, 31, 64, 101}) {
+    for (double density : {0.2, 1.0}) {
+      Graph graph = make_random_graph(size, density, 5, seed++);
+      SpanTree heap = GraphAlgorithms::GetSpanTreeHeap(graph);
+      SpanTree dense = GraphAlgorithms::GetSpanTreeDense(graph);
+      EXPECT_EQ(dense.tree_weight, heap.tree_weight);
+      EXPECT_EQ(dense.edges, heap.edges);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdLevels, DenseGraphTest,
+                         ::testing::Values(Simd::Level::kScalar,
+                                           Simd::Level::kAvx2,
+                                           Simd::Level::kAvx512));
+
+TEST(DenseGraphSelectionTest, EdgeDensity) {
+  Graph empty(4);
+  EXPECT_DOUBLE_EQ(GraphAlgorithms::edge_density(empty), 0.0);
+  Graph full = make_random_graph(6, 1.0, 9, 3);
+  full[2][2] = 4;
+  EXPECT_DOUBLE_EQ(GraphAlgorithms::edge_density(full), 1.0);
+  EXPECT_TRUE(GraphAlgorithms::is_dense_graph(full));
+  EXPECT_FALSE(GraphAlgorithms::is_dense_graph(empty));
+  // Remembered density follows changes of the graph
+  full.set_edge_weight(0, 1, 0);
+  EXPECT_DOUBLE_EQ(GraphAlgorithms::edge_density(full), 29.0 / 30.0);
+  Graph copy = full;
+  EXPECT_DOUBLE_EQ(GraphAlgorithms::edge_density(copy), 29.0 / 30.0);
+}
+
+TEST(DenseGraphSelectionTest, DispatchKeepsResults) {
+  Graph sparse = make_random_graph(80, 0.02, 30, 11);
+  Graph dense = make_random_graph(80, 0.9, 30, 12);
+  EXPECT_EQ(GraphAlgorithms::GetShortPath(sparse, 0).distances,
+            GraphAlgorithms::GetShortPathHeap(sparse, 0).distances);
+  EXPECT_EQ(GraphAlgorithms::GetShortPath(dense, 0).distances,
+            GraphAlgorithms::GetShortPathHeap(dense, 0).distances);
+  EXPECT_EQ(GraphAlgorithms::GetSpanTree(dense).tree_weight,
+            GraphAlgorithms::GetSpanTreeHeap(dense).tree_weight);
+}
+
+TEST(DenseGraphSelectionTest, SimdLevelIsClamped) {
+  Simd::set_level(Simd::Level::kAvx512);
+  EXPECT_LE(Simd::get_level(), Simd::detected_level());
+  Simd::set_level(Simd::detected_level());
+}
@@ -0,0 +1,44 @@
+#include "../s21_graph_tests.h"
+
+TEST(DistanceTableTest, MatchesShortPath) {
+  unsigned seed = 700;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.03, 0.1, 0.6}) {
+      Graph graph = make_random_graph(60, density, 40, seed++, symmetric);
+      Alias::IntRow sources = {1, 5, 60, 17, 5, 33};
+      Alias::IntRow targets = {2, 60, 1, 44, 44, 9, 17};
+      DistanceTable table =
+          GraphAlgorithms::GetDistanceTable(graph, sources, targets);
+      ASSERT_EQ(table.sources_count, sources.size());
+      ASSERT_EQ(table.targets_count, targets.size());
+      ASSERT_EQ(table.distances.size(), sources.size() * targets.size());
+      for (size_t row = 0; row < sources.size(); ++row) {
+        ShortPath tree = GraphAlgorithms::GetShortPath(graph, sources[row] - 1);
+        for (size_t column = 0; column < targets.size(); ++column) {
+          EXPECT_EQ(table.at(row, column),
+                    tree.distances[targets[column] - 1]);
+        }
+      }
+    }
+  }
+}
+
+TEST(DistanceTableTest, OneToMany) {
+  Graph graph = make_random_graph(40, 0.1, 10, 710, false);
+  Alias::IntRow targets(40);
+  for (int i = 0; i < 40; ++i) targets[i] = i + 1;
+  DistanceTable table = GraphAlgorithms::GetDistanceTable(graph, {7}, targets);
+  ShortPath tree = GraphAlgorithms::GetShortPath(graph, 6);
+  EXPECT_EQ(table.distances, tree.distances);
+}
+
+TEST(DistanceTableTest, EmptyAndInvalid) {
+  Graph graph = make_random_graph(10, 0.3, 10, 720);
+  DistanceTable table = GraphAlgorithms::GetDistanceTable(graph, {}, {1, 2});
+  EXPECT_EQ(table.sources_count, 0u);
+  EXPECT_TRUE(table.distances.empty());
+  EXPECT_THROW(GraphAlgorithms::GetDistanceTable(graph, {0}, {1}),
+               std::invalid_argument);
+  EXPECT_THROW(GraphAlgorithms::GetDistanceTable(graph, {1}, {11}),
+               std::invalid_argument);
+}
@@ -0,0 +1,98 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_dynamic_short_path.h"
+
+namespace {
+void expect_valid_tree(const Graph& graph, const DynamicShortPath& dynamic) {
+  const ShortPath& path = dynamic.get_short_path();
+  const ShortPath expected =
+      GraphAlgorithms::GetShortPath(graph, dynamic.get_start_index());
+  ASSERT_EQ(path.distances, expected.distances);
+  for (size_t i = 0; i < graph.get_graph_size(); ++i) {
+    const int prev = path.prev_nodes[i];
+    if (path.distances[i] == UINT_MAX ||
+        static_cast<int>(i) == dynamic.get_start_index()) {
+      EXPECT_EQ(prev, -1);
+    } else {
+      ASSERT_NE(prev, -1);
+      EXPECT_GT(graph[prev][i], 0);
+      EXPECT_EQ(path.distances[prev] + graph[prev][i], path.distances[i]);
+    }
+  }
+}
+}  // namespace
+
+TEST(DynamicShortPathTest, MatchesRecomputation) {
+  unsigned seed = 800;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.05, 0.2}) {
+      Graph graph = make_random_graph(50, density, 20, seed, symmetric);
+      std::mt19937 random(seed++);
+      std::uniform_int_distribution<int> vertex(0, 49);
+      std::uniform_int_distribution<int> weight(0, 25);
+      DynamicShortPath dynamic(graph, 3);
+      for (int step = 0; step < 150; ++step) {
+        const int from = vertex(random), to = vertex(random);
+        const int new_weight = weight(random) == 0 ? 0 : weight(random) + 1;
+        const int old_weight = graph.set_edge_weight(from, to, new_weight);
+        dynamic.UpdateEdge(graph, from, to, old_weight);
+        if (symmetric) {
+          graph.set_edge_weight(to, from, new_weight);
+          dynamic.UpdateEdge(graph, to, from, old_weight);
+        }
+        EXPECT_EQ(dynamic.get_revision(), graph.get_revision());
+        expect_valid_tree(graph, dynamic);
+      }
+    }
+  }
+}
+
+TEST(DynamicShortPathTest, TouchesOnlyAffectedVertices) {
+  Graph graph(5);
+  // Chain 0 -> 1 -> 2 -> 3 -> 4 and a long bypass 0 -> 4
+  for (int i = 0; i < 4; ++i) graph.set_edge_weight(i, i + 1, 1);
+  graph.set_edge_weight(0, 4, 10);
+  DynamicShortPath dynamic(graph, 0);
+  // Not a tree edge
+  dynamic.UpdateEdge(graph, 0, 4, graph.set_edge_weight(0, 4, 20));
+  EXPECT_EQ(dynamic.get_affected_count(), 0u);
+  // Tree edge, the subtree below it moves to the bypass
+  dynamic.UpdateEdge(graph, 2, 3, graph.set_edge_weight(2, 3, 0));
+  EXPECT_EQ(dynamic.get_affected_count(), 2u);
+  EXPECT_EQ(dynamic.get_short_path().distances[3], UINT_MAX);
+  EXPECT_EQ(dynamic.get_short_path().distances[4], 20u);
+  expect_valid_tree(graph, dynamic);
+  // Shortcut to the end only moves the end
+  dynamic.UpdateEdge(graph, 1, 4, graph.set_edge_weight(1, 4, 2));
+  EXPECT_EQ(dynamic.get_affected_count(), 1u);
+  EXPECT_EQ(dynamic.get_short_path().distances[4], 3u);
+  expect_valid_tree(graph, dynamic);
+}
+
+TEST(DynamicShortPathTest, Invalid) {
+  Graph graph = make_random_graph(10, 0.3, 10, 810);
+  EXPECT_THROW(DynamicShortPath(graph, 10), std::invalid_argument);
+  DynamicShortPath dynamic(graph, 0);
+  EXPECT_THROW(dynamic.UpdateEdge(graph, 0, 10, 1), std::invalid_argument);
+  EXPECT_THROW(dynamic.UpdateEdge(make_random_graph(11, 0.3, 10, 811), 0, 1, 1),
+               std::invalid_argument);
+}
+
+TEST(DynamicShortPathTest, RemovedEdgeMustExist) {
+  Graph graph = make_random_graph(10, 0.3, 10, 820);
+  DynamicShortPath dynamic(graph, 0);
+  size_t to = 1;
+  while (graph[0][to] == 0) ++to;
+  const int old_weight = graph.set_edge_weight(0, to, 0);
+  dynamic.UpdateEdge(graph, 0, to, old_weight);
+  // Second removal of the same edge
+  EXPECT_THROW(dynamic.UpdateEdge(graph, 0, to, old_weight),
+               std::invalid_argument);
+  // Removal of an edge which never existed
+  size_t missing = 1;
+  while (graph[0][missing] != 0 || missing == to) ++missing;
+  EXPECT_THROW(dynamic.UpdateEdge(graph, 0, missing, 5),
+               std::invalid_argument);
+  EXPECT_EQ(dynamic.get_short_path().distances,
+            GraphAlgorithms::GetShortPathHeap(graph, 0).distances);
+}
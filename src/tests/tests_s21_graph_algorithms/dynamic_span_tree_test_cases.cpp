@@ -0,0 +1,82 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_dynamic_span_tree.h"
+
+TEST(DynamicSpanTreeTest, MatchesRebuildAfterInsertions) {
+  unsigned seed = 1500;
+  for (size_t size : {1, 2, 30, 150}) {
+    for (double density : {0.0, 0.02, 0.2}) {
+      Graph graph = make_random_graph(size, density, 100, seed);
+      DynamicSpanTree tree(graph);
+      EXPECT_EQ(tree.get_tree_weight(),
+                GraphAlgorithms::GetSpanTreeWeight(graph));
+      std::mt19937 gen(seed++);
+      std::uniform_int_distribution<size_t> vertex(0, size - 1);
+      std::uniform_int_distribution<int> weight(1, 100);
+      for (int step = 0; step < 200; ++step) {
+        const size_t from = vertex(gen), to = vertex(gen);
+        const int cell = weight(gen);
+        const bool changed = tree.AddEdge(from, to, cell);
+        if (from != to && (graph[from][to] == 0 || cell < graph[from][to])) {
+          graph[from][to] = graph[to][from] = cell;
+        } else {
+          EXPECT_FALSE(changed);
+        }
+        const SpanTree expected = GraphAlgorithms::GetSpanTree(graph);
+        EXPECT_EQ(tree.get_tree_weight(), expected.tree_weight);
+        const SpanTree result = tree.GetSpanTree();
+        EXPECT_EQ(result.tree_weight, expected.tree_weight);
+        EXPECT_EQ(result.edges.size(), expected.edges.size());
+        for (const TreeEdge& edge : result.edges)
+          EXPECT_EQ(edge.weight, graph[edge.parent][edge.child]);
+      }
+    }
+  }
+}
+
+TEST(DynamicSpanTreeTest, CheaperEdge) {
+  Graph graph(4);
+  graph.valid_graph_ = true;
+  for (auto [from, to, weight] :
+       {std::tuple{0, 1, 5}, {1, 2, 3}, {2, 3, 2}, {0, 3, 9}})
+    graph[from][to] = graph[to][from] = weight;
+  DynamicSpanTree tree(graph);
+  EXPECT_EQ(tree.get_tree_weight(), 10);
+  EXPECT_EQ(tree.get_edges_count(), 3u);
+  // Cheaper edge 0 - 3 replaces 0 - 1, the heaviest one of the cycle
+  EXPECT_TRUE(tree.AddEdge(3, 0, 4));
+  std::vector<TreeEdge> edges = {{2, 1, 3}, {3, 2, 2}, {0, 3, 4}};
+  EXPECT_EQ(tree.GetSpanTree().edges, edges);
+  EXPECT_EQ(tree.GetSpanTree().parents, Alias::IntRow({-1, 2, 3, 0}));
+  // Tree edge becomes cheaper, a heavier one is ignored
+  EXPECT_TRUE(tree.AddEdge(1, 2, 1));
+  EXPECT_FALSE(tree.AddEdge(1, 2, 7));
+  EXPECT_FALSE(tree.AddEdge(0, 1, 6));
+  EXPECT_EQ(tree.get_tree_weight(), 7);
+  EXPECT_EQ(tree.get_edges_count(), 3u);
+}
+
+TEST(DynamicSpanTreeTest, JoinsTrees) {
+  Graph graph(4);
+  graph.valid_graph_ = true;
+  graph[2][3] = graph[3][2] = 6;
+  DynamicSpanTree tree(graph);
+  EXPECT_EQ(tree.get_tree_weight(), 0);
+  EXPECT_TRUE(tree.GetSpanTree().edges.empty());
+  EXPECT_TRUE(tree.AddEdge(0, 1, 2));
+  EXPECT_EQ(tree.get_tree_weight(), 2);
+  EXPECT_TRUE(tree.AddEdge(1, 3, -1));
+  EXPECT_EQ(tree.get_tree_weight(), 7);
+  EXPECT_EQ(tree.GetSpanTree().parents, Alias::IntRow({-1, 0, 3, 1}));
+}
+
+TEST(DynamicSpanTreeTest, Throws) {
+  Graph empty(0);
+  EXPECT_THROW(DynamicSpanTree{empty}, std::invalid_argument);
+  Graph directed = make_random_graph(10, 0.5, 9, 1510, false);
+  EXPECT_THROW(DynamicSpanTree{directed}, std::invalid_argument);
+  DynamicSpanTree tree(make_random_graph(10, 0.5, 9, 1511));
+  EXPECT_THROW(tree.AddEdge(0, 10, 1), std::invalid_argument);
+  EXPECT_THROW(tree.AddEdge(0, 1, 0), std::invalid_argument);
+  EXPECT_FALSE(tree.AddEdge(4, 4, 1));
+}
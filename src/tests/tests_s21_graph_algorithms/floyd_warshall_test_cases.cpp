@@ -0,0 +1,173 @@
+#include "../s21_graph_tests.h"
+
+TEST(FloydWarshallTest, BlockedMatchesSimple) {
+  unsigned seed = 900;
+  for (bool symmetric : {true, false}) {
+    for (size_t size : {1, 2, 15, 63, 64, 65, 150}) {
+      for (double density : {0.02, 0.1, 0.5}) {
+        Graph graph = make_random_graph(size, density, 50, seed++, symmetric);
+        EXPECT_EQ(GraphAlgorithms::GetShortestPathsFloydBlocked(graph),
+                  GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+      }
+    }
+  }
+}
+
+TEST(FloydWarshallTest, SeveralTiles) {
+  Graph graph = make_random_graph(300, 0.03, 100, 915, false);
+  EXPECT_EQ(GraphAlgorithms::GetShortestPathsFloydBlocked(graph),
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+}
+
+TEST(FloydWarshallTest, UnevenTiles) {
+  Graph graph = make_random_graph(50, 0.08, 30, 920, false);
+  DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+  EXPECT_EQ(matrix.get_stride(), 64u);
+  FloydWarshall::Run(matrix, 7);
+  EXPECT_EQ(matrix.ToGrid(),
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+}
+
+TEST(FloydWarshallTest, ThreadCountDoesNotChangeResult) {
+  Graph graph = make_random_graph(150, 0.05, 40, 925, false);
+  const Alias::IntGrid expected =
+      GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+  for (size_t threads : {1, 2, 3, 5}) {
+    s21::thread_pool pool(threads);
+    for (FloydWarshall::CellWidth width :
+         {FloydWarshall::CellWidth::kUint16, FloydWarshall::CellWidth::kInt32,
+          FloydWarshall::CellWidth::kChecked}) {
+      DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+      FloydWarshall::Run(matrix, 16, width, pool);
+      EXPECT_EQ(matrix.ToGrid(), expected);
+    }
+    EXPECT_EQ(GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+                  graph, ApspOptions{threads}),
+              expected);
+  }
+}
+
+TEST(FloydWarshallTest, Invalid) {
+  Graph graph(0);
+  EXPECT_THROW(GraphAlgorithms::GetShortestPathsFloydBlocked(graph),
+               std::invalid_argument);
+}
+
+class FloydWarshallKernelTest : public ::testing::TestWithParam<Simd::Level> {
+ protected:
+  void SetUp() override { Simd::set_level(GetParam()); }
+  void TearDown() override { Simd::set_level(Simd::detected_level()); }
+};
+
+TEST_P(FloydWarshallKernelTest, EveryWidthMatchesSimple) {
+  using FloydWarshall::CellWidth;
+  unsigned seed = 930;
+  for (size_t size : {3, 40, 77, 130}) {
+    for (double density : {0.03, 0.3}) {
+      Graph graph = make_random_graph(size, density, 400, seed++, false);
+      const Alias::IntGrid expected =
+          GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+      for (CellWidth width :
+           {CellWidth::kUint16, CellWidth::kInt32, CellWidth::kChecked}) {
+        DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+        FloydWarshall::Run(matrix, 32, width);
+        EXPECT_EQ(matrix.ToGrid(), expected);
+      }
+    }
+  }
+}
+
+TEST_P(FloydWarshallKernelTest, SaturatedSums) {
+  // Sums of two paths overflow 16 bits while every shortest path fits
+  Graph graph = make_random_graph(40, 1.0, 1600, 940, false);
+  DistanceMatrix matrix = DistanceMatrix::FromGraph(graph);
+  ASSERT_EQ(FloydWarshall::cell_width(matrix),
+            FloydWarshall::CellWidth::kUint16);
+  FloydWarshall::Run(matrix, 16);
+  EXPECT_EQ(matrix.ToGrid(),
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdLevels, FloydWarshallKernelTest,
+                         ::testing::Values(Simd::Level::kScalar,
+                                           Simd::Level::kAvx2,
+                                           Simd::Level::kAvx512));
+
+TEST(FloydWarshallWidthTest, PicksNarrowestCells) {
+  using FloydWarshall::CellWidth;
+  Graph graph(4);
+  graph[0][1] = 100;
+  graph[1][2] = 21000;
+  EXPECT_EQ(FloydWarshall::cell_width(DistanceMatrix::FromGraph(graph)),
+            CellWidth::kUint16);
+  graph[2][3] = 30000;
+  EXPECT_EQ(FloydWarshall::cell_width(DistanceMatrix::FromGraph(graph)),
+            CellWidth::kInt32);
+  graph[3][0] = 400000000;
+  EXPECT_EQ(FloydWarshall::cell_width(DistanceMatrix::FromGraph(graph)),
+            CellWidth::kChecked);
+  graph[3][0] = -1;
+  EXPECT_EQ(FloydWarshall::cell_width(DistanceMatrix::FromGraph(graph)),
+            CellWidth::kChecked);
+  graph[3][0] = 0;
+  graph.valid_graph_ = true;
+  EXPECT_EQ(GraphAlgorithms::GetShortestPathsFloydBlocked(graph),
+            GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+}
+
+TEST(NextHopMatrixTest, PathsAreShortest) {
+  unsigned seed = 950;
+  for (bool symmetric : {true, false}) {
+    for (size_t size : {5, 80, 260}) {
+      Graph graph = make_random_graph(size, 0.04, 30, seed++, symmetric);
+      ApspResult result = GraphAlgorithms::GetShortestPathsWithNextHops(graph);
+      EXPECT_EQ(result.distances,
+                GraphAlgorithms::GetShortestPathsFloydSimple(graph));
+      EXPECT_EQ(result.next_hops.get_cell_bytes(), size < 255 ? 1u : 2u);
+      for (size_t from = 0; from < size; from += 7) {
+        for (size_t to = 0; to < size; ++to) {
+          Alias::IntRow path = result.next_hops.GetPath(from + 1, to + 1);
+          if (from != to && result.distances[from][to] == 0) {
+            EXPECT_TRUE(path.empty());
+            continue;
+          }
+          ASSERT_FALSE(path.empty());
+          EXPECT_EQ(path.front(), static_cast<int>(from + 1));
+          EXPECT_EQ(path.back(), static_cast<int>(to + 1));
+          int length = 0;
+          for (size_t i = 1; i < path.size(); ++i)
+            length += graph[path[i - 1] - 1][path[i] - 1];
+          EXPECT_EQ(length, result.distances[from][to]);
+        }
+      }
+    }
+  }
+}
+
+TEST(NextHopMatrixTest, CellWidths) {
+  EXPECT_EQ(NextHopMatrix(254).get_cell_bytes(), 1u);
+  EXPECT_EQ(NextHopMatrix(255).get_cell_bytes(), 2u);
+  NextHopMatrix hops(3);
+  EXPECT_EQ(hops.get(0, 2), NextHopMatrix::kNoHop);
+  hops.set(0, 2, 1);
+  EXPECT_EQ(hops.get(0, 2), 1u);
+  EXPECT_THROW(hops.GetPath(0, 1), std::invalid_argument);
+  EXPECT_THROW(hops.GetPath(1, 4), std::invalid_argument);
+  // Hops going around without reaching the target
+  hops.set(1, 2, 0);
+  EXPECT_THROW(hops.GetPath(1, 3), std::invalid_argument);
+  hops.set(1, 2, NextHopMatrix::kNoHop);
+  EXPECT_THROW(hops.GetPath(1, 3), std::invalid_argument);
+}
+
+TEST(NextHopMatrixTest, RejectsNegativeCycle) {
+  Graph graph(3);
+  graph[0][1] = 2;
+  graph[1][2] = -3;
+  graph[2][0] = 4;
+  graph.valid_graph_ = true;
+  EXPECT_NO_THROW(GraphAlgorithms::GetShortestPathsWithNextHops(graph));
+  graph[2][1] = 1;
+  EXPECT_THROW(GraphAlgorithms::GetShortestPathsWithNextHops(graph),
+               std::invalid_argument);
+}
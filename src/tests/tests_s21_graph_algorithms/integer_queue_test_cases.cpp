@@ -0,0 +1,103 @@
+#include "../s21_graph_tests.h"
+
+namespace {
+
+// Pushes random monotone keys into queue and checks pops against sorted keys
+template <typename Queue>
+void expect_sorted_pops(Queue& queue, unsigned max_step, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<unsigned> step(0, max_step);
+  std::multiset<unsigned> expected;
+  unsigned last = 0;
+  for (int round = 0; round < 2000; ++round) {
+    if (expected.empty() || gen() % 3 != 0) {
+      unsigned key = last + step(gen);
+      queue.push(key, key * 2);
+      expected.insert(key);
+    } else {
+      auto [key, value] = queue.top();
+      ASSERT_EQ(key, *expected.begin());
+      EXPECT_EQ(value, key * 2);
+      expected.erase(expected.begin());
+      queue.pop();
+      last = key;
+    }
+    EXPECT_EQ(queue.size(), expected.size());
+  }
+}
+
+}  // namespace
+
+TEST(IntegerQueueTest, RadixHeapOrder) {
+  s21::radix_heap<unsigned> heap;
+  EXPECT_TRUE(heap.empty());
+  expect_sorted_pops(heap, 1000000, 600);
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  expect_sorted_pops(heap, 3, 601);
+}
+
+TEST(IntegerQueueTest, BucketQueueOrder) {
+  s21::bucket_queue<unsigned> queue(50);
+  EXPECT_TRUE(queue.empty());
+  expect_sorted_pops(queue, 50, 602);
+  queue.clear();
+  expect_sorted_pops(queue, 0, 603);
+}
+
+TEST(IntegerQueueTest, BucketQueueMovesBack) {
+  s21::bucket_queue<int> queue(10);
+  queue.push(7, 1);
+  queue.push(9, 2);
+  EXPECT_EQ(queue.top().first, 7u);
+  queue.push(2, 3);
+  EXPECT_EQ(queue.top(), std::make_pair(2u, 3));
+  queue.pop();
+  queue.pop();
+  queue.push(0, 4);
+  EXPECT_EQ(queue.top(), std::make_pair(0u, 4));
+  queue.pop();
+  EXPECT_EQ(queue.top(), std::make_pair(9u, 2));
+}
+
+TEST(IntegerQueueTest, ShortPathMatchesHeap) {
+  unsigned seed = 610;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.03, 0.3}) {
+      for (int max_weight : {1, 5, 1000}) {
+        Graph graph =
+            make_random_graph(60, density, max_weight, seed++, symmetric);
+        for (int start : {0, 31}) {
+          ShortPath expected = GraphAlgorithms::GetShortPathHeap(graph, start);
+          for (ShortPath result :
+               {GraphAlgorithms::GetShortPathBuckets(graph, start),
+                GraphAlgorithms::GetShortPathBuckets(graph, start, max_weight),
+                GraphAlgorithms::GetShortPathRadixHeap(graph, start),
+                GraphAlgorithms::GetShortPath(graph, start)}) {
+            EXPECT_EQ(result.distances, expected.distances);
+            EXPECT_EQ(result.prev_nodes, expected.prev_nodes);
+          }
+        }
+      }
+    }
+  }
+  Graph graph = make_random_graph(5, 0.5, 3, 620);
+  EXPECT_TRUE(GraphAlgorithms::GetShortPathBuckets(graph, 5).distances.empty());
+  EXPECT_TRUE(
+      GraphAlgorithms::GetShortPathRadixHeap(graph, -1).distances.empty());
+}
+
+TEST(IntegerQueueTest, SpanTreeMatchesHeapWeight) {
+  unsigned seed = 630;
+  for (double density : {0.05, 0.3}) {
+    for (int max_weight : {1, 4, 900}) {
+      Graph graph = make_random_graph(50, density, max_weight, seed++);
+      SpanTree expected = GraphAlgorithms::GetSpanTreeHeap(graph);
+      SpanTree result = GraphAlgorithms::GetSpanTreeBuckets(graph);
+      EXPECT_EQ(result.tree_weight, expected.tree_weight);
+      EXPECT_EQ(result.edges.size(), expected.edges.size());
+    }
+  }
+  EXPECT_EQ(GraphAlgorithms::max_edge_weight(make_random_graph(9, 1.0, 7, 640)),
+            7u);
+}
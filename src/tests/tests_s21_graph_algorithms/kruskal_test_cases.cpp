@@ -0,0 +1,94 @@
+#include "../s21_graph_tests.h"
+
+TEST(DisjointSetTest, UniteAndFind) {
+  s21::disjoint_set sets(6);
+  EXPECT_EQ(sets.set_count(), 6u);
+  EXPECT_TRUE(sets.unite(0, 1));
+  EXPECT_TRUE(sets.unite(2, 3));
+  EXPECT_TRUE(sets.unite(1, 3));
+  EXPECT_FALSE(sets.unite(0, 2));
+  EXPECT_TRUE(sets.same(0, 3));
+  EXPECT_FALSE(sets.same(0, 4));
+  EXPECT_EQ(sets.set_size(2), 4u);
+  EXPECT_EQ(sets.set_count(), 3u);
+  sets.reset(2);
+  EXPECT_EQ(sets.size(), 2u);
+  EXPECT_FALSE(sets.same(0, 1));
+}
+
+TEST(RadixSortTest, StableOnAnyPool) {
+  std::mt19937 random(1300);
+  for (size_t count : {0, 1, 100, 50000}) {
+    for (unsigned max_key : {7u, 70000u, UINT_MAX}) {
+      std::vector<std::pair<unsigned, size_t>> items(count);
+      for (size_t i = 0; i < count; ++i)
+        items[i] = {static_cast<unsigned>(random() % (max_key + 1ull)), i};
+      std::vector<std::pair<unsigned, size_t>> expected = items;
+      std::stable_sort(
+          expected.begin(), expected.end(),
+          [](const auto& a, const auto& b) { return a.first < b.first; });
+      for (size_t threads : {1, 3}) {
+        std::vector<std::pair<unsigned, size_t>> sorted = items;
+        s21::thread_pool pool(threads);
+        s21::radix_sort(
+            sorted, [](const auto& item) { return item.first; }, pool);
+        EXPECT_EQ(sorted, expected);
+      }
+    }
+  }
+}
+
+namespace {
+
+// Vertices with a parent, vertex 0 included
+std::vector<bool> spanned_vertices(const SpanTree& a_tree) {
+  std::vector<bool> result(a_tree.parents.size(), false);
+  for (size_t i = 0; i < a_tree.parents.size(); ++i)
+    result[i] = i == 0 || a_tree.parents[i] != -1;
+  return result;
+}
+
+}  // namespace
+
+TEST(KruskalTest, SameWeightAsPrim) {
+  unsigned seed = 1310;
+  for (size_t size : {1, 2, 30, 200}) {
+    for (double density : {0.01, 0.05, 0.3}) {
+      for (int max_weight : {3, 100000}) {
+        Graph graph = make_random_graph(size, density, max_weight, seed++);
+        const SpanTree prim = GraphAlgorithms::GetSpanTreeHeap(graph);
+        const SpanTree kruskal = GraphAlgorithms::GetSpanTreeKruskal(graph, 2);
+        EXPECT_EQ(kruskal.tree_weight, prim.tree_weight);
+        const std::vector<bool> spanned = spanned_vertices(kruskal);
+        EXPECT_EQ(spanned, spanned_vertices(prim));
+        // A tree of graph edges over the spanned vertices
+        for (const TreeEdge& edge : kruskal.edges) {
+          EXPECT_EQ(kruskal.parents[edge.child], edge.parent);
+          EXPECT_EQ(edge.weight, graph[edge.parent][edge.child]);
+        }
+        EXPECT_EQ(kruskal.edges.size() + 1,
+                  static_cast<size_t>(
+                      std::count(spanned.begin(), spanned.end(), true)));
+        for (MstStrategy strategy :
+             {MstStrategy::kAuto, MstStrategy::kPrim, MstStrategy::kKruskal})
+          EXPECT_EQ(GraphAlgorithms::GetSpanTree(graph, strategy).tree_weight,
+                    prim.tree_weight);
+      }
+    }
+  }
+}
+
+TEST(KruskalTest, DirectedGraph) {
+  Graph graph = make_random_graph(40, 0.05, 20, 1320, false);
+  EXPECT_THROW(GraphAlgorithms::GetSpanTreeKruskal(graph),
+               std::invalid_argument);
+  EXPECT_THROW(GraphAlgorithms::GetSpanTree(graph, MstStrategy::kKruskal),
+               std::invalid_argument);
+  EXPECT_EQ(GraphAlgorithms::pick_mst_strategy(graph), MstStrategy::kKruskal);
+  // kAuto falls back to Prim's algorithm
+  EXPECT_EQ(GraphAlgorithms::GetSpanTree(graph).tree_weight,
+            GraphAlgorithms::GetSpanTreeHeap(graph).tree_weight);
+  EXPECT_EQ(
+      GraphAlgorithms::pick_mst_strategy(make_random_graph(40, 0.5, 20, 1321)),
+      MstStrategy::kPrim);
+}
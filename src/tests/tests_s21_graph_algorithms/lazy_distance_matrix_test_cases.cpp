@@ -0,0 +1,75 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_lazy_distance_matrix.h"
+
+TEST(LazyDistanceMatrixTest, MatchesFloyd) {
+  unsigned seed = 1100;
+  for (bool symmetric : {true, false}) {
+    for (size_t size : {1, 12, 90}) {
+      Graph graph = make_random_graph(size, 0.08, 40, seed++, symmetric);
+      const Alias::IntGrid expected =
+          GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+      LazyDistanceMatrix matrix(graph);
+      for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(matrix[i], expected[i]);
+        EXPECT_EQ(matrix.at(i, size - 1), expected[i][size - 1]);
+      }
+      EXPECT_EQ(matrix.get_misses(), size);
+      EXPECT_EQ(matrix.get_hits(), size);
+      EXPECT_EQ(matrix.get_revision(), graph.get_revision());
+    }
+  }
+}
+
+TEST(LazyDistanceMatrixTest, EvictsUnderMemoryLimit) {
+  Graph graph = make_random_graph(40, 0.1, 20, 1110, false);
+  const size_t row_bytes = sizeof(Alias::IntRow) + 40 * sizeof(int);
+  LazyDistanceMatrix matrix(graph, 3 * row_bytes);
+  for (size_t i : {0, 1, 2, 0, 3}) matrix[i];
+  EXPECT_EQ(matrix.get_cached_rows(), 3u);
+  EXPECT_EQ(matrix.get_memory_usage(), 3 * row_bytes);
+  EXPECT_TRUE(matrix.is_cached(0));
+  EXPECT_FALSE(matrix.is_cached(1));
+  EXPECT_EQ(matrix.get_misses(), 4u);
+
+  // Rows larger than the limit are computed on every access
+  matrix.set_memory_limit(row_bytes - 1);
+  EXPECT_EQ(matrix.get_cached_rows(), 0u);
+  EXPECT_EQ(matrix[5], GraphAlgorithms::GetShortestPathsFloydSimple(graph)[5]);
+  EXPECT_FALSE(matrix.is_cached(5));
+}
+
+TEST(LazyDistanceMatrixTest, Prefetch) {
+  Graph graph = make_random_graph(120, 0.05, 30, 1120, false);
+  const Alias::IntGrid expected =
+      GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+  LazyDistanceMatrix matrix(graph);
+  matrix[7];
+  matrix.Prefetch({3, 7, 50, 3, 119}, 3);
+  EXPECT_EQ(matrix.get_misses(), 4u);
+  EXPECT_EQ(matrix.get_cached_rows(), 4u);
+  for (size_t i : {3, 7, 50, 119}) EXPECT_EQ(matrix[i], expected[i]);
+  EXPECT_EQ(matrix.get_misses(), 4u);
+  EXPECT_THROW(matrix.Prefetch({0, 120}), std::invalid_argument);
+  EXPECT_THROW(matrix[120], std::invalid_argument);
+  EXPECT_THROW(matrix.at(0, 120), std::invalid_argument);
+}
+
+TEST(LazyDistanceMatrixTest, NegativeWeights) {
+  // Edges only go to larger indexes, so negative weights make no cycles
+  Graph graph = make_random_graph(50, 0.15, 30, 1130, false);
+  std::mt19937 random(1131);
+  for (size_t i = 0; i < 50; ++i) {
+    for (size_t j = 0; j <= i; ++j) graph[i][j] = 0;
+    for (size_t j = i + 1; j < 50; ++j) {
+      if (graph[i][j] != 0 && random() % 3 == 0) graph[i][j] -= 20;
+    }
+  }
+  const Alias::IntGrid expected =
+      GraphAlgorithms::GetShortestPathsFloydSimple(graph);
+  LazyDistanceMatrix matrix(graph);
+  for (size_t i = 0; i < 50; ++i) EXPECT_EQ(matrix[i], expected[i]);
+  graph[49][0] = -1000;
+  EXPECT_THROW(LazyDistanceMatrix{graph}, std::invalid_argument);
+  EXPECT_THROW(LazyDistanceMatrix{Graph(0)}, std::invalid_argument);
+}
@@ -0,0 +1,115 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_bidirectional_dijkstra.h"
+
+namespace {
+
+Graph make_line_graph(size_t a_size) {
+  Graph graph(a_size);
+  graph.valid_graph_ = true;
+  for (size_t i = 1; i < a_size; ++i) {
+    graph[i - 1][i] = 1;
+    graph[i][i - 1] = 1;
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(PointToPointTest, RouteMatchesFullTree) {
+  unsigned seed = 200;
+  for (double density : {0.03, 0.2, 0.9}) {
+    Graph graph = make_random_graph(60, density, 20, seed++, false);
+    for (int from = 1; from <= 60; from += 7) {
+      ShortPath tree = GraphAlgorithms::GetShortPath(graph, from - 1);
+      for (int to = 1; to <= 60; to += 5) {
+        RouteResult route =
+            GraphAlgorithms::GetShortestRouteBetweenVertices(graph, from, to);
+        EXPECT_EQ(route.distance, tree.distances[to - 1]);
+        if (route.distance == UINT_MAX) {
+          EXPECT_TRUE(route.vertices.empty());
+          continue;
+        }
+        ASSERT_FALSE(route.vertices.empty());
+        EXPECT_EQ(route.vertices.front(), from);
+        EXPECT_EQ(route.vertices.back(), to);
+        EXPECT_EQ(route_length(graph, route.vertices), route.distance);
+      }
+    }
+  }
+}
+
+TEST(PointToPointTest, StopsAtTarget) {
+  Graph graph = make_line_graph(50);
+  for (int start : {0, 10}) {
+    ShortPath heap = GraphAlgorithms::GetShortPathHeap(graph, start, 12);
+    ShortPath dense = GraphAlgorithms::GetShortPathDense(graph, start, 12);
+    EXPECT_EQ(heap.distances[12], 12u - start);
+    EXPECT_EQ(dense.distances[12], 12u - start);
+    EXPECT_EQ(heap.distances[40], UINT_MAX);
+    EXPECT_EQ(dense.distances[40], UINT_MAX);
+  }
+}
+
+TEST(PointToPointTest, WrappersShareOneRun) {
+  Graph graph = make_line_graph(5);
+  RouteResult route =
+      GraphAlgorithms::GetShortestRouteBetweenVertices(graph, 2, 5);
+  EXPECT_EQ(route.distance, 3u);
+  EXPECT_EQ(route.vertices, Alias::IntRow({2, 3, 4, 5}));
+  EXPECT_EQ(GraphAlgorithms::GetShortestPathBetweenVertices(graph, 2, 5),
+            route.distance);
+  EXPECT_EQ(GraphAlgorithms::GetShortestVectorBetweenVertices(graph, 2, 5),
+            route.vertices);
+}
+
+TEST(PointToPointTest, InvalidVertices) {
+  Graph graph = make_line_graph(4);
+  EXPECT_THROW(GraphAlgorithms::GetShortestRouteBetweenVertices(graph, 0, 2),
+               std::invalid_argument);
+  EXPECT_THROW(GraphAlgorithms::GetShortestVectorBetweenVertices(graph, 1, 5),
+               std::invalid_argument);
+}
+
+TEST(CsrGraphTest, ForwardAndTransposed) {
+  Graph graph(3);
+  graph[0][1] = 4;
+  graph[0][2] = 5;
+  graph[2][1] = 6;
+  graph[1][1] = 7;
+  CsrGraph forward = CsrGraph::FromGraph(graph);
+  CsrGraph backward = CsrGraph::Transposed(graph);
+  EXPECT_EQ(forward.get_vertices_count(), 3u);
+  EXPECT_EQ(forward.get_edges_count(), 3u);
+  EXPECT_EQ(forward.degree(0), 2u);
+  EXPECT_EQ(forward.target(forward.begin(2)), 1u);
+  EXPECT_EQ(forward.weight(forward.begin(2)), 6u);
+  EXPECT_EQ(backward.degree(0), 0u);
+  ASSERT_EQ(backward.degree(1), 2u);
+  EXPECT_EQ(backward.target(backward.begin(1)), 0u);
+  EXPECT_EQ(backward.target(backward.begin(1) + 1), 2u);
+  EXPECT_EQ(backward.weight(backward.begin(1) + 1), 6u);
+}
+
+TEST(BidirectionalDijkstraTest, MatchesUnidirectional) {
+  unsigned seed = 300;
+  for (bool symmetric : {true, false}) {
+    for (double density : {0.02, 0.1, 0.5}) {
+      Graph graph = make_random_graph(70, density, 30, seed++, symmetric);
+      BidirectionalDijkstra search(graph);
+      EXPECT_EQ(search.is_symmetric(), symmetric);
+      expect_same_routes(graph, search, 4);
+    }
+  }
+}
+
+TEST(BidirectionalDijkstraTest, ExploresFewVertices) {
+  Graph graph = make_line_graph(1000);
+  BidirectionalDijkstra search(graph);
+  RouteResult route = search.FindRoute(500, 504);
+  EXPECT_EQ(route.distance, 4u);
+  EXPECT_EQ(route.vertices, Alias::IntRow({500, 501, 502, 503, 504}));
+  EXPECT_LT(search.get_settled_count(), 10u);
+  EXPECT_EQ(search.FindRoute(7, 7).vertices, Alias::IntRow({7}));
+  EXPECT_THROW(search.FindRoute(0, 7), std::invalid_argument);
+}
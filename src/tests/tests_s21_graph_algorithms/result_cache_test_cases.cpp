@@ -0,0 +1,136 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_result_cache.h"
+
+namespace {
+
+// Empty cache directory removed at the end of a test
+class ResultCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override { std::filesystem::remove_all(directory_); }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_ =
+      std::filesystem::temp_directory_path() / "s21_result_cache_test";
+};
+
+}  // namespace
+
+TEST_F(ResultCacheTest, SurvivesRestart) {
+  Graph graph = make_random_graph(30, 0.3, 50, 1200);
+  const Alias::IntGrid distances =
+      GraphAlgorithms::GetShortestPathsBetweenAllVertices(graph);
+  const SpanTree tree = GraphAlgorithms::GetSpanTree(graph);
+  {
+    ResultCache cache(directory_);
+    EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(graph), distances);
+    EXPECT_EQ(cache.GetSpanTree(graph).tree_weight, tree.tree_weight);
+    EXPECT_EQ(cache.get_misses(), 2u);
+    EXPECT_EQ(cache.get_hits(), 0u);
+  }
+  // Same contents in another graph object, like a reloaded file
+  Graph reloaded = make_random_graph(30, 0.3, 50, 1200);
+  ResultCache cache(directory_);
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(reloaded), distances);
+  const SpanTree cached_tree = cache.GetSpanTree(reloaded);
+  EXPECT_EQ(cached_tree.edges, tree.edges);
+  EXPECT_EQ(cached_tree.parents, tree.parents);
+  EXPECT_EQ(cached_tree.tree_weight, tree.tree_weight);
+  EXPECT_EQ(cache.get_hits(), 2u);
+  EXPECT_EQ(cache.get_misses(), 0u);
+
+  reloaded.set_edge_weight(0, 1, 1000);
+  cache.GetShortestPathsBetweenAllVertices(reloaded);
+  EXPECT_EQ(cache.get_misses(), 1u);
+  EXPECT_GT(cache.get_disk_usage(), 0u);
+  cache.clear();
+  EXPECT_EQ(cache.get_disk_usage(), 0u);
+}
+
+TEST_F(ResultCacheTest, RejectsDamagedFiles) {
+  Graph graph = make_random_graph(20, 0.3, 50, 1210);
+  const Alias::IntGrid distances =
+      GraphAlgorithms::GetShortestPathsBetweenAllVertices(graph);
+  ResultCache cache(directory_);
+  cache.GetShortestPathsBetweenAllVertices(graph);
+  const std::filesystem::path path =
+      cache.file_path(graph.get_fingerprint(), ResultCache::Kind::kApsp);
+  ASSERT_TRUE(std::filesystem::exists(path));
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(100);
+    file.put('\x7f');
+  }
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(graph), distances);
+  EXPECT_EQ(cache.get_rejected(), 1u);
+  EXPECT_EQ(cache.get_misses(), 2u);
+
+  std::filesystem::resize_file(path, 60);
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(graph), distances);
+  EXPECT_EQ(cache.get_rejected(), 2u);
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(graph), distances);
+  EXPECT_EQ(cache.get_hits(), 1u);
+}
+
+TEST_F(ResultCacheTest, EvictsOverDiskLimit) {
+  const size_t file_bytes = 48 + (1 + 20 * 20) * sizeof(int);
+  ResultCache cache(directory_, 2 * file_bytes);
+  std::vector<Graph> graphs;
+  for (unsigned seed = 1220; seed < 1223; ++seed)
+    graphs.push_back(make_random_graph(20, 0.3, 50, seed));
+  for (const Graph& graph : graphs) {
+    cache.GetShortestPathsBetweenAllVertices(graph);
+    EXPECT_LE(cache.get_disk_usage(), 2 * file_bytes);
+  }
+  EXPECT_EQ(cache.get_disk_usage(), 2 * file_bytes);
+  cache.GetShortestPathsBetweenAllVertices(graphs[2]);
+  EXPECT_EQ(cache.get_hits(), 1u);
+  cache.set_disk_limit(file_bytes);
+  EXPECT_EQ(cache.get_disk_usage(), file_bytes);
+  cache.set_disk_limit(0);
+  EXPECT_EQ(cache.get_disk_usage(), 0u);
+  EXPECT_THROW(cache.GetShortestPathsBetweenAllVertices(Graph(3)),
+               std::invalid_argument);
+}
+
+TEST_F(ResultCacheTest, DisabledWithoutDirectory) {
+  Graph graph = make_random_graph(20, 0.3, 50, 1230);
+  ResultCache cache("");
+  EXPECT_FALSE(cache.is_enabled());
+  cache.GetShortestPathsBetweenAllVertices(graph);
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(graph),
+            GraphAlgorithms::GetShortestPathsBetweenAllVertices(graph));
+  EXPECT_EQ(cache.get_misses(), 2u);
+  EXPECT_EQ(cache.get_hits(), 0u);
+  EXPECT_EQ(cache.get_disk_usage(), 0u);
+}
+
+TEST_F(ResultCacheTest, UserDirectory) {
+  const char* cache_home = std::getenv("XDG_CACHE_HOME");
+  const char* home = std::getenv("HOME");
+  const std::string saved_cache_home = cache_home ? cache_home : "";
+  const std::string saved_home = home ? home : "";
+
+  setenv("XDG_CACHE_HOME", directory_.c_str(), 1);
+  const std::filesystem::path user = ResultCache::UserDirectory();
+  EXPECT_EQ(user, directory_ / "s21_navigator");
+  EXPECT_TRUE(std::filesystem::is_directory(user));
+  EXPECT_EQ(std::filesystem::status(user).permissions(),
+            std::filesystem::perms::owner_all);
+  EXPECT_TRUE(ResultCache(user).is_enabled());
+
+  // Relative XDG_CACHE_HOME is ignored, a file in place of HOME is unusable
+  std::ofstream(directory_ / "file").put('x');
+  setenv("XDG_CACHE_HOME", "relative", 1);
+  setenv("HOME", (directory_ / "file").c_str(), 1);
+  EXPECT_TRUE(ResultCache::UserDirectory().empty());
+  unsetenv("HOME");
+  EXPECT_TRUE(ResultCache::UserDirectory().empty());
+
+  if (cache_home)
+    setenv("XDG_CACHE_HOME", saved_cache_home.c_str(), 1);
+  else
+    unsetenv("XDG_CACHE_HOME");
+  if (home) setenv("HOME", saved_home.c_str(), 1);
+}
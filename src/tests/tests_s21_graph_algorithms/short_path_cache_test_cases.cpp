@@ -0,0 +1,78 @@
+#include "../s21_graph_tests.h"
+
+#include "../../lib/s21_graph_algorithms/s21_short_path_cache.h"
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+  s21::lru_cache<int, std::string> cache(3);
+  cache.insert(1, "one");
+  cache.insert(2, "two");
+  cache.insert(3, "three");
+  ASSERT_NE(cache.find(1), nullptr);
+  cache.insert(4, "four");
+  EXPECT_EQ(cache.find(2), nullptr);
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+  EXPECT_EQ(*cache.find(1), "one");
+  EXPECT_EQ(cache.size(), 3u);
+
+  cache.insert(5, "five", 2);
+  EXPECT_EQ(cache.cost(), 3u);
+  EXPECT_EQ(cache.find(3), nullptr);
+  EXPECT_EQ(cache.find(4), nullptr);
+  EXPECT_EQ(cache.insert(6, "six", 4), nullptr);
+  EXPECT_TRUE(cache.erase(5));
+  EXPECT_FALSE(cache.erase(5));
+  EXPECT_EQ(cache.cost(), 1u);
+  cache.set_capacity(0);
+  EXPECT_TRUE(cache.empty());
+}
+
+TEST(ShortPathCacheTest, HitsAndMisses) {
+  Graph graph = make_random_graph(50, 0.1, 20, 800, false);
+  ShortPathCache cache;
+  for (int round = 0; round < 3; ++round) {
+    for (int from : {1, 7, 50}) {
+      for (int to : {2, 30, 50}) {
+        RouteResult expected =
+            GraphAlgorithms::GetShortestRouteBetweenVertices(graph, from, to);
+        RouteResult route =
+            cache.GetShortestRouteBetweenVertices(graph, from, to);
+        EXPECT_EQ(route.distance, expected.distance);
+        EXPECT_EQ(route.vertices, expected.vertices);
+      }
+    }
+  }
+  EXPECT_EQ(cache.get_misses(), 3u);
+  EXPECT_EQ(cache.get_hits(), 24u);
+  EXPECT_EQ(cache.get_size(), 3u);
+  EXPECT_GT(cache.get_memory_usage(), 0u);
+  EXPECT_THROW(cache.GetShortestRouteBetweenVertices(graph, 0, 1),
+               std::invalid_argument);
+}
+
+TEST(ShortPathCacheTest, InvalidatedByModification) {
+  Graph graph = make_random_graph(20, 0.3, 20, 810);
+  ShortPathCache cache;
+  cache.GetShortPath(graph, 0);
+  cache.GetShortPath(graph, 0);
+  EXPECT_EQ(cache.get_hits(), 1u);
+  graph[0][5] = 1;
+  graph[5][0] = 1;
+  EXPECT_EQ(cache.GetShortPath(graph, 0).distances[5], 1u);
+  EXPECT_EQ(cache.get_misses(), 2u);
+  EXPECT_EQ(cache.get_size(), 1u);
+}
+
+TEST(ShortPathCacheTest, MemoryLimit) {
+  Graph graph = make_random_graph(100, 0.05, 20, 820);
+  ShortPathCache cache(1);
+  const ShortPath& tree = cache.GetShortPath(graph, 3);
+  EXPECT_EQ(tree.distances, GraphAlgorithms::GetShortPath(graph, 3).distances);
+  EXPECT_EQ(cache.get_size(), 0u);
+
+  ShortPathCache small(3 * sizeof(ShortPath) + 2000);
+  for (int start = 0; start < 10; ++start) small.GetShortPath(graph, start);
+  EXPECT_LE(small.get_memory_usage(), small.get_memory_limit());
+  EXPECT_LT(small.get_size(), 10u);
+  EXPECT_GT(small.get_size(), 0u);
+}
@@ -83,9 +83,35 @@ TEST_F(AntsGraphAlgorithmsTest, AntTransitionProbability) {
   Ant ant(0);
   ant.visit_vertex(graph3_, 1);
 
-  double prob = anthill.ant_transition_probability(ant, 2);
+  // Step buffers keep the candidates and running sums of their weights
+  anthill.choose_next_vertex(ant);
+  ASSERT_EQ(ant.candidates_, (std::vector<Alias::node_index>{0, 2}));
+  const double sum = ant.cumulative_weights_.back();
+  double prob = (sum - ant.cumulative_weights_.front()) / sum;
   EXPECT_GT(prob, 0);
   EXPECT_LT(prob, 1);
+  EXPECT_DOUBLE_EQ(prob, anthill.ant_desire_to_neighbor(ant, 2) / sum);
+}
+
+TEST_F(AntsGraphAlgorithmsTest, ChoiceWeightTables) {
+  AntHill anthill(graph4_);
+  anthill.set_beta_distance_weight_(3.0);
+  anthill.set_alpha_pheromone_weight(1.5);
+  Ant ant(1);
+  for (size_t j = 0; j < 4; ++j) {
+    const double expected =
+        j == 1 ? 0.0
+               : pow(1.0 / graph4_[1][j], 3.0) *
+                     pow(anthill.pheromone_matrix_[1][j], 1.5);
+    EXPECT_DOUBLE_EQ(anthill.ant_desire_to_neighbor(ant, j), expected);
+  }
+  // Weights follow the pheromone once per iteration
+  anthill.pheromone_matrix_[1][2] = 4.0;
+  EXPECT_DOUBLE_EQ(anthill.ant_desire_to_neighbor(ant, 2),
+                   pow(1.0 / 35, 3.0));
+  anthill.update_choice_weights();
+  EXPECT_DOUBLE_EQ(anthill.ant_desire_to_neighbor(ant, 2),
+                   pow(1.0 / 35, 3.0) * pow(4.0, 1.5));
 }
 
 TEST_F(AntsGraphAlgorithmsTest, TSP_SmallGraph) {
@@ -119,7 +145,7 @@ TEST_F(AntsGraphAlgorithmsTest, PheromoneUpdate) {
   ant.visit_vertex(graph3_, 0);
 
   double initial_pheromone = anthill.pheromone_matrix_[0][1];
-  anthill.update_pheromone(ant);
+  anthill.update_pheromone({ant});
   double updated_pheromone = anthill.pheromone_matrix_[0][1];
 
   EXPECT_NE(initial_pheromone, updated_pheromone);
@@ -133,6 +159,125 @@ TEST_F(AntsGraphAlgorithmsTest, ChooseNextVertex) {
   EXPECT_TRUE(next == 1 || next == 2);
 }
 
+TEST_F(AntsGraphAlgorithmsTest, ChooseNextVertexDistribution) {
+  AntHill anthill(graph4_);
+  anthill.prepare_ants();
+  Ant& ant = anthill.ant_squad_[0];
+  ant.visit_vertex(graph4_, 0);
+  ant.visit_vertex(graph4_, 1);
+  const double* weights = anthill.choice_weights_.data() + 4;
+  const double sum = weights[2] + weights[3];
+  const int draws = 20000;
+  int third = 0;
+  for (int i = 0; i < draws; ++i) {
+    const size_t next = anthill.choose_next_vertex(ant);
+    ASSERT_TRUE(next == 2 || next == 3);
+    third += next == 3;
+  }
+  // Five standard deviations of the binomial count
+  const double expected = weights[3] / sum;
+  EXPECT_NEAR(static_cast<double>(third) / draws, expected,
+              5 * std::sqrt(expected * (1 - expected) / draws));
+  EXPECT_EQ(ant.candidates_.capacity(), 4u);
+  ant.visit_vertex(graph4_, 2);
+  ant.visit_vertex(graph4_, 3);
+  EXPECT_EQ(anthill.choose_next_vertex(ant), 3u);
+}
+
+TEST(XoshiroTest, Streams) {
+  s21::xoshiro256pp random(42);
+  EXPECT_EQ(random(), 0xd0764d4f4476689fULL);
+  EXPECT_EQ(random(), 0x519e4174576f3791ULL);
+  EXPECT_EQ(random(), 0xfbe07cfb0c24ed8cULL);
+  s21::xoshiro256pp copy = random;
+  double batch[64];
+  random.fill_uniform(batch, 64);
+  for (double value : batch) {
+    EXPECT_EQ(value, copy.uniform());
+    EXPECT_GE(value, 0.0);
+    EXPECT_LT(value, 1.0);
+  }
+  s21::xoshiro256pp jumped = random;
+  jumped.jump();
+  EXPECT_FALSE(jumped == random);
+  EXPECT_NE(jumped(), random());
+  std::uniform_int_distribution<int> dice(1, 6);
+  for (int i = 0; i < 100; ++i) {
+    const int value = dice(random);
+    EXPECT_TRUE(value >= 1 && value <= 6);
+  }
+}
+
+TEST(SeededAntHillTest, SameSeedSameRoute) {
+  Graph graph = make_random_graph(25, 1.0, 100, 1600);
+  AntHill first(graph), second(graph);
+  first.set_seed(7);
+  second.set_seed(7);
+  const TsmResult route = first.solve_salesman_graph();
+  const TsmResult replay = second.solve_salesman_graph();
+  EXPECT_EQ(replay.vertices, route.vertices);
+  EXPECT_EQ(replay.distance, route.distance);
+  EXPECT_EQ(first.get_seed(), 7u);
+}
+
+TEST(SeededAntHillTest, SameRouteForAnyThreads) {
+  Graph graph = make_random_graph(40, 0.7, 100, 1610);
+  AntHill single(graph);
+  single.set_seed(11);
+  single.set_threads(1);
+  const TsmResult route = single.solve_salesman_graph();
+  for (size_t threads : {2, 3, 8}) {
+    AntHill parallel(graph);
+    parallel.set_seed(11);
+    parallel.set_threads(threads);
+    const TsmResult replay = parallel.solve_salesman_graph();
+    EXPECT_EQ(replay.vertices, route.vertices);
+    EXPECT_EQ(replay.distance, route.distance);
+    EXPECT_EQ(parallel.pheromone_matrix_, single.pheromone_matrix_);
+  }
+}
+
+TEST(SeededAntHillTest, EveryIterationBuildsTours) {
+  Graph graph = make_random_graph(20, 1.0, 100, 1620);
+  AntHill first_iteration(graph), colony(graph);
+  first_iteration.set_seed(13);
+  colony.set_seed(13);
+  first_iteration.prepare_ants();
+  for (Ant& ant : first_iteration.ant_squad_) first_iteration.build_tour(ant);
+  const TsmResult best = colony.solve_salesman_graph();
+  size_t changed = 0;
+  for (size_t i = 0; i < colony.ant_squad_.size(); ++i) {
+    const TsmResult& tour = colony.ant_squad_[i].ant_path_;
+    ASSERT_EQ(tour.vertices.size(), graph.get_graph_size() + 1);
+    EXPECT_LE(best.distance, tour.distance);
+    changed += tour.vertices != first_iteration.ant_squad_[i].ant_path_.vertices;
+  }
+  EXPECT_GT(changed, 0u);
+}
+
+TEST_F(AntsGraphAlgorithmsTest, PheromoneUpdateOfManyAnts) {
+  AntHill anthill(graph3_);
+  anthill.set_p_pheromone_evaporation_coef(0.5);
+  std::vector<Ant> ants(2, Ant(0));
+  for (size_t vertex : {1, 2, 0}) ants[0].visit_vertex(graph3_, vertex);
+  for (size_t vertex : {2, 1, 0}) ants[1].visit_vertex(graph3_, vertex);
+  // Evaporation and deposit of one ant after another
+  Alias::PheromoneGrid expected = anthill.pheromone_matrix_;
+  for (const Ant& ant : ants) {
+    for (auto& row : expected) {
+      for (double& cell : row) cell *= 0.5;
+    }
+    const auto& path = ant.get_ant_path_result().vertices;
+    for (size_t i = 1; i < path.size(); ++i)
+      expected[path[i - 1]][path[i]] += ant.pheromone_to_add(100.0);
+  }
+  anthill.update_pheromone(ants);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j)
+      EXPECT_DOUBLE_EQ(anthill.pheromone_matrix_[i][j], expected[i][j]);
+  }
+}
+
 TEST_F(AntsGraphAlgorithmsTest, TSP_FullGraph) {
   AntHill anthill(full_graph5_);
   TsmResult result = anthill.solve_salesman_graph();
@@ -128,8 +128,10 @@ void View::set_dijkstra() {
     int vertex_2{0};
     std::cin >> vertex_2;
     try {
-      unsigned path = GraphAlgorithms::GetShortestPathBetweenVertices(
-          graph_, vertex_1, vertex_2);
+      unsigned path = short_path_cache_
+                          .GetShortestRouteBetweenVertices(graph_, vertex_1,
+                                                           vertex_2)
+                          .distance;
       std::cout << Color::green;
       print_string(Menu::ui_line);
       print_string(Menu::result_label);
@@ -170,6 +172,30 @@ void View::set_floyd_or_tree(
     Menu::print_error_bad_graph();
 }
 
+void View::set_span_tree() {
+  if (graph_.is_valid_graph()) {
+    try {
+      SpanTree res = result_cache_.GetSpanTree(graph_);
+      std::cout << Color::green;
+      print_string(Menu::ui_line);
+      print_string(Menu::result_label);
+      new_line();
+      for (const TreeEdge& edge : res.edges) {
+        std::cout << edge.parent + 1 << " - " << edge.child + 1 << " ("
+                  << edge.weight << ")";
+        new_line();
+      }
+      std::cout << "Tree weight: " << res.tree_weight;
+      new_line();
+      print_string(Menu::ui_line);
+      std::cout << Color::color_end;
+    } catch (std::invalid_argument& e) {
+      Menu::print_error_invalid_graph(e);
+    }
+  } else
+    Menu::print_error_bad_graph();
+}
+
 void View::set_ants() {
   if (graph_.is_valid_graph()) {
     try {
@@ -240,12 +266,14 @@ ActionsMap actions(View& a_view) {
   };
   result[USER_INPUT::FLOYD] = [&]() {
     a_view.print_current_graph_info();
-    a_view.set_floyd_or_tree(
-        GraphAlgorithms::GetShortestPathsBetweenAllVertices);
+    a_view.set_floyd_or_tree([&](const Graph& a_graph) {
+      return a_view.get_result_cache().GetShortestPathsBetweenAllVertices(
+          a_graph);
+    });
   };
   result[USER_INPUT::TREE] = [&]() {
     a_view.print_current_graph_info();
-    a_view.set_floyd_or_tree(GraphAlgorithms::GetLeastSpanningTree);
+    a_view.set_span_tree();
   };
   result[USER_INPUT::ANTS] = [&]() {
     a_view.print_current_graph_info();
@@ -26,6 +26,8 @@
 
 #include "../lib/s21_graph/s21_graph.h"
 #include "../lib/s21_graph_algorithms/s21_graph_algorithms.h"
+#include "../lib/s21_graph_algorithms/s21_result_cache.h"
+#include "../lib/s21_graph_algorithms/s21_short_path_cache.h"
 
 /**
  * @namespace Color
@@ -76,8 +78,8 @@ static const std::string floyd_long =
     "Find shortest paths between all vertices. Returns the matrix of shortest "
     "paths";
 static const std::string tree_long =
-    "Find minimal spanning tree. Returns the adjacency matrix for minimal "
-    "spanning tree";
+    "Find minimal spanning tree. Returns the edges of minimal spanning tree "
+    "and its weight";
 static const std::string ants_long =
     "Solution of the traveling salesman problem. Returns the "
     "resulting route and its length";
@@ -199,6 +201,11 @@ class View {
    */
   void set_floyd_or_tree(std::function<Alias::IntGrid(const Graph&)> a_func);
 
+  /**
+   * @brief Finds minimum spanning tree and prints its edges
+   */
+  void set_span_tree();
+
   /**
    * @brief Exports graph to DOT format
    */
@@ -210,13 +217,22 @@ class View {
    */
   bool is_graph_loaded() const { return graph_.is_valid_graph(); }
 
+  /**
+   * @brief Gets cache of results kept between runs
+   * @return Result cache
+   */
+  ResultCache& get_result_cache() { return result_cache_; }
+
 #ifdef TEST
  public:
 #else
  private:
-#endif                    // TEST
-  Graph graph_;           ///< Current graph instance
-  std::string filename_;  ///< Current graph filename
+#endif                               // TEST
+  Graph graph_;                      ///< Current graph instance
+  std::string filename_;             ///< Current graph filename
+  ShortPathCache short_path_cache_;  ///< Trees of graph_ for set_dijkstra
+  /// Results of Floyd and MST kept between runs
+  ResultCache result_cache_{ResultCache::UserDirectory()};
 };
 
 /**